@@ -9,6 +9,7 @@
 #include <trail.voting.hpp>
 #include <eosio/action.hpp>
 #include <eosio/asset.hpp>
+#include <eosio/crypto.hpp>
 #include <eosio/eosio.hpp>
 #include <eosio/permission.hpp>
 #include <eosio/singleton.hpp>
@@ -27,7 +28,7 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
   public:
 	using contract::contract;
 
-	const symbol native_sym = symbol("TLOS", 4);
+	static constexpr symbol native_sym = symbol("TLOS", 4);
 
 	arbitration(name s, name code, datastream<const char *> ds);
 
@@ -35,8 +36,36 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 
 	const uint8_t MAX_UNREAD_CLAIMS = 21;
 
+	//NOTE: casefile.approvals holds one bit per panel seat
+	const uint8_t MAX_PANEL_SIZE = 32;
+
+	//NOTE: max arbitrators rows read by the assignment engine per call
+	const uint8_t MAX_ASSIGN_SCAN = 50;
+
+	//NOTE: units of work (candidates visited, nominees cleared or carried, inline calls) done per endelection call
+	const uint8_t MAX_ELECTION_BATCH = 25;
+
+	//NOTE: case removals done inline by dismissarb, the rest is queued for cleanarbs
+	const uint8_t MAX_CLEANUP_BATCH = 25;
+
+	//NOTE: bumped whenever the arbevent layout or event meanings change
+	const uint8_t ARB_EVENT_VERSION = 1;
+
+	//NOTE: stands in for the status of a case that doesn't exist (yet), see track_case
+	const uint8_t NO_STATUS = UINT8_MAX;
+
+	//NOTE: kept per claim from memo filings, whose rows are billed to the contract
+	const int64_t MEMO_CLAIM_DEPOSIT = 5000;
+
 	[[eosio::action]] void setconfig(uint16_t max_elected_arbs, uint32_t election_duration, uint32_t start_election, uint32_t arbitrator_term_length, vector<int64_t> fees);
 
+	//NOTE: number of arbitrators auto assigned when a case is readied, 0 disables auto assignment.
+	// A case opens with as many as are available, assigncase tops up short panels later.
+	[[eosio::action]] void setpanelsize(uint8_t arbs_per_case);
+
+	//NOTE: seconds a case may stay in each case_state, indexed by case_state, 0 means no deadline
+	[[eosio::action]] void setdeadlines(vector<uint32_t> case_deadlines);
+
 #pragma region Enums
 
 	//TODO: describe each enum in README
@@ -89,6 +118,40 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 		CLOSED  // 3
 	};
 
+	//NOTE: endelection progress, stored in config so any call can resume it
+	enum election_phase : uint8_t
+	{
+		PHASE_IDLE,  // 0 NOTE: no election is being finalized
+		PHASE_SEAT,  // 1 NOTE: seating winners, election_cursor indexes the leaderboard candidates
+		PHASE_PERMS, // 2
+		PHASE_CLOSE, // 3 NOTE: close ballot, start the next election if possible
+		PHASE_CLEAR, // 4 NOTE: clearing leftover nominees
+		PHASE_CARRY  // 5 NOTE: adding leftover nominees to the new ballot, election_cursor is the next nominee
+	};
+
+	//NOTE: event_type of arbevent, ref_id meaning noted per event (0 when unused)
+	enum case_event : uint8_t
+	{
+		CASE_FILED,			// 0 NOTE: ref_id is the first unread claim_id
+		CLAIM_ADDED,		// 1 NOTE: ref_id is the unread claim_id
+		CLAIM_REMOVED,		// 2 NOTE: ref_id is the unread claim_id
+		CASE_SHREDDED,		// 3
+		CASE_READIED,		// 4
+		ARB_ASSIGNED,		// 5 NOTE: actor is the assigned arbitrator
+		CLAIM_RESPONDED,	// 6 NOTE: ref_id is the unread claim_id
+		CLAIM_DISMISSED,	// 7 NOTE: ref_id is the unread claim_id
+		CLAIM_ACCEPTED,		// 8 NOTE: ref_id is the new claims table id
+		CASE_APPROVED,		// 9 NOTE: approval recorded, case did not advance yet
+		CASE_ADVANCED,		// 10
+		RULING_SET,			// 11
+		CASE_DISMISSED,		// 12
+		ARB_RECUSED,		// 13
+		ARB_REMOVED,		// 14 NOTE: arbitrator dismissed from the case by the BPs
+		CASE_DELETED,		// 15
+		CASE_ARCHIVED,		// 16
+		CASE_OVERDUE		// 17 NOTE: deadline for the current case_status passed, sent once by sweepcases
+	};
+
 	enum lang_code : uint8_t
 	{
 		ENGL, //0 English
@@ -139,14 +202,13 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 
 	//NOTE: filing a case doesn't require a respondent
 	[[eosio::action]] void filecase(name claimant, string claim_link, vector<uint8_t> lang_codes,
-	        std::optional<name> respondant);
-
-	[[eosio::action]] void execfile(uint64_t new_case_id, name claimant, string claim_link,
-	        vector<uint8_t> lang_codes, name respondant);
+		std::optional<name> respondant);
 
 	//NOTE: adds subsequent claims to a case
 	[[eosio::action]] void addclaim(uint64_t case_id, string claim_link, name claimant);
 
+	[[eosio::action]] void addclaims(uint64_t case_id, vector<string> claim_links, name claimant);
+
 	//NOTE: claims can only be removed by a claimant during case setup
 	[[eosio::action]] void removeclaim(uint64_t case_id, string claim_hash, name claimant);
 
@@ -156,6 +218,14 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 	//NOTE: enforce claimant has at least 1 claim before readying
 	[[eosio::action]] void readycase(uint64_t case_id, name claimant);
 
+	//NOTE: filecase, addclaims and readycase in one action, the filing fee must already be deposited.
+	// A TLOS transfer with memo "filecase|<respondant>|<lang codes>|<claim links>" does the same
+	// in transfer_handler, e.g. "filecase|bob|0,1|Qm...,Qm..." (respondant may be left empty).
+	// eosio.token caps memos at 256 bytes, so a memo filing carries about 4 CIDv0 links. The transfer
+	// must cover the filing fee plus MEMO_CLAIM_DEPOSIT per claim, the deposit is kept for the RAM used.
+	[[eosio::action]] void fileready(name claimant, vector<string> claim_links, vector<uint8_t> lang_codes,
+		std::optional<name> respondant);
+
 #pragma endregion Case_Setup
 
 #pragma region Case_Progression
@@ -167,13 +237,27 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 
 	[[eosio::action]] void addarbs(uint64_t case_id, name assigned_arb, uint8_t num_arbs_to_assign);
 
+	//NOTE: permissionless, retries auto assignment for a case left in AWAITING_ARBS or with fewer than arbs_per_case arbitrators
+	[[eosio::action]] void assigncase(uint64_t case_id);
+
 	[[eosio::action]] void dismissclaim(uint64_t case_id, name assigned_arb, string claim_hash, string memo);
 
+	[[eosio::action]] void dismissclaims(uint64_t case_id, name assigned_arb, vector<string> claim_hashes, string memo);
+
 	[[eosio::action]] void acceptclaim(uint64_t case_id, name assigned_arb, string claim_hash, string decision_link,
 	        uint8_t decision_class);
 
-	[[eosio::action]] void execclaim(uint64_t new_claim_id, uint64_t case_id, name assigned_arb, string claim_hash,
-                                     string decision_link, uint8_t decision_class);
+	//NOTE: one ruling in an acceptclaims batch
+	struct claim_decision
+	{
+		string claim_hash;
+		string decision_link;
+		uint8_t decision_class;
+
+		EOSLIB_SERIALIZE(claim_decision, (claim_hash)(decision_link)(decision_class))
+	};
+
+	[[eosio::action]] void acceptclaims(uint64_t case_id, name assigned_arb, vector<claim_decision> decisions);
 
 	[[eosio::action]] void advancecase(uint64_t case_id, name assigned_arb);
 
@@ -183,6 +267,10 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 
 	[[eosio::action]] void recuse(uint64_t case_id, string rationale, name assigned_arb);
 
+	//NOTE: inline notification sent by the contract on every case transition, see case_event
+	[[eosio::action]] void arbevent(uint8_t version, uint8_t event_type, uint64_t case_id, uint8_t case_status,
+	        name actor, uint64_t ref_id);
+
 	//NOTE: removed from v1, to be implemented in a future version.
 	// [[eosio::action]] void newjoinder(uint64_t base_case_id, uint64_t joining_case_id, name arb); 
 
@@ -197,6 +285,15 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 	[[eosio::action]] void newarbstatus(uint8_t new_status, name arbitrator);
 
 	[[eosio::action]] void deletecase(uint64_t case_id);
+
+	//NOTE: permissionless, moves up to max closed cases into the archives table
+	[[eosio::action]] void archivecases(uint16_t max);
+
+	//NOTE: permissionless, removes dismissed arbitrators from up to max of their open cases
+	[[eosio::action]] void cleanarbs(uint16_t max);
+
+	//NOTE: permissionless, shreds stale CASE_SETUP cases and flags other overdue cases, up to max
+	[[eosio::action]] void sweepcases(uint16_t max);
 	
 	//TODO: deletearb action, removes EXPIRED or REMOVED status arbs from the arbitrators table
 #pragma endregion Arb_Actions
@@ -249,6 +346,10 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 
 #pragma region Tables and Structs
 
+	//NOTE: binary ipfs cid, 34 bytes for CIDv0 (sha2-256 multihash), 36 bytes for CIDv1 (version + codec + multihash).
+	// empty when no document has been linked.
+	typedef vector<char> ipfs_cid;
+
 	/**
    * Holds all arbitrator nominee applications.
    * @scope get_self().value
@@ -257,7 +358,7 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 	struct [[eosio::table]] nominee
 	{
 		name nominee_name;
-		string credentials_link;
+		ipfs_cid credentials_link;
 		uint32_t application_time;
 
 		uint64_t primary_key() const { return nominee_name.value; }
@@ -268,73 +369,144 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
    * Holds all currently elected arbitrators.
    * @scope get_self().value
    * @key uint64_t arb.value
+   * @index bylangs (arb_status << 48 | languages << 32 | open_cases), byexpiration (term_expiration, expired seats last)
    */
 	struct [[eosio::table]] arbitrator
 	{
 		name arb;
 		uint8_t arb_status;
-		vector<uint64_t> open_case_ids;
-		vector<uint64_t> closed_case_ids;
-		string credentials_link; //NOTE: ipfs_url of arbitrator credentials
+		uint32_t open_cases; //NOTE: count of assignments rows for this arb
+		uint32_t closed_cases;
+		ipfs_cid credentials_link; //NOTE: ipfs cid of arbitrator credentials
 		uint32_t elected_time;
 		uint32_t term_expiration;
-		vector<uint8_t> languages; //NOTE: language codes
+		uint16_t languages; //NOTE: bitset, bit n set when the arbitrator speaks lang_code n
 
 		uint64_t primary_key() const { return arb.value; }
-		EOSLIB_SERIALIZE(arbitrator, (arb)(arb_status)(open_case_ids)(closed_case_ids)(credentials_link)
+		uint64_t by_langs() const
+		{
+			return (static_cast<uint64_t>(arb_status) << 48) | (static_cast<uint64_t>(languages) << 32) | open_cases;
+		}
+		uint64_t by_expiration() const { return arb_status == SEAT_EXPIRED ? UINT64_MAX : term_expiration; }
+		EOSLIB_SERIALIZE(arbitrator, (arb)(arb_status)(open_cases)(closed_cases)(credentials_link)
 		    (elected_time)(term_expiration)(languages))
 	};
 
-	//NOTE: Stores all information related to a single claim.
+	/**
+   * Stores all information related to a single claim.
+   * Accepted claims are stored in claims (@scope get_self().value),
+   * pending claims are stored in unreadclaims (@scope case_id).
+   * @key claim_id
+   */
 	struct [[eosio::table]] claim
 	{
 		uint64_t claim_id;
-		string claim_summary; //NOTE: ipfs link to claim document from claimant
-		string decision_link; //NOTE: ipfs link to decision document from arbitrator
-		string response_link; //NOTE: ipfs link to response document from respondant (if any)
+		ipfs_cid claim_summary; //NOTE: ipfs cid of claim document from claimant
+		ipfs_cid decision_link; //NOTE: ipfs cid of decision document from arbitrator
+		ipfs_cid response_link; //NOTE: ipfs cid of response document from respondant (if any)
 		uint8_t decision_class;
 
 		uint64_t primary_key() const { return claim_id; }
 		EOSLIB_SERIALIZE(claim, (claim_id)(claim_summary)(decision_link)(response_link)(decision_class))
 	};
 
+	/**
+   * Locates every pending and accepted claim by its document hash, across all cases.
+   * @scope get_self().value
+   * @key uint64_t ref_id
+   * @index byhash (sha2-256 digest carried in claim_summary, not unique),
+   * bycasehash (sha256 of doc_hash | case_id | accepted, one entry per claim)
+   */
+	struct [[eosio::table]] claim_ref
+	{
+		uint64_t ref_id;
+		checksum256 doc_hash;
+		uint64_t case_id;
+		uint64_t claim_id;
+		bool accepted; //NOTE: claim_id is in claims when set, otherwise in unreadclaims scoped by case_id
+
+		static checksum256 case_hash(const checksum256& doc_hash, uint64_t case_id, bool accepted)
+		{
+			std::array<uint8_t, 41> data;
+			auto digest = doc_hash.extract_as_byte_array();
+			std::copy(digest.begin(), digest.end(), data.begin());
+			for (uint8_t i = 0; i < 8; i++) {
+				data[32 + i] = uint8_t(case_id >> (56 - 8 * i));
+			}
+			data[40] = accepted ? 1 : 0;
+			return sha256(reinterpret_cast<const char*>(data.data()), data.size());
+		}
+
+		uint64_t primary_key() const { return ref_id; }
+		checksum256 by_hash() const { return doc_hash; }
+		checksum256 by_case_hash() const { return case_hash(doc_hash, case_id, accepted); }
+		EOSLIB_SERIALIZE(claim_ref, (ref_id)(doc_hash)(case_id)(claim_id)(accepted))
+	};
+
 	/**
    * Case Files for all arbitration cases.
    * @scope get_self().value
    * @key case_id
+   * @index byclaimant, byrespondant, byuuid (claimant << 64 | respondant), bystatus,
+   * bydeadline (case_status << 64 | deadline)
    */
 	struct [[eosio::table]] casefile
 	{
-		//NOTE: alternative table design. No secondary indices. Scope by claimant. Index by respondant.
-		//pros: easy to track by claimant, no longer need secondary indexes.
-		//cons: limited discoverability, must avoid secondary indexes.
 		uint64_t case_id;
 		uint8_t case_status;
 
 		name claimant;
 		name respondant;
 		vector<name> arbitrators;
-		vector<name> approvals;
+		uint32_t approvals; //NOTE: bit i set when arbitrators[i] approved advancing the case
 
-		vector<uint8_t> required_langs;
+		uint16_t required_langs; //NOTE: bitset of lang_code, same layout as arbitrator.languages
 
-		vector<claim> unread_claims;
 		vector<uint64_t> accepted_claims;
-		string case_ruling;
+		ipfs_cid case_ruling;
 		uint32_t last_edit; //TODO: do we need to keep this? If so, then we need to update it everytime an action modifies
+		uint32_t filed_time;
+		uint32_t deadline; //NOTE: set on each case_status change from config.case_deadlines, 0 when none or already swept
 
 		uint64_t primary_key() const { return case_id; }
 
+		uint64_t by_status() const { return case_status; }
 		uint64_t by_claimant() const { return claimant.value; }
+		uint64_t by_respondant() const { return respondant.value; }
 		uint128_t by_uuid() const
 		{
 			uint128_t claimant_id = static_cast<uint128_t>(claimant.value);
 			uint128_t respondant_id = static_cast<uint128_t>(respondant.value);
 			return (claimant_id << 64) | respondant_id;
 		}
+		uint128_t by_deadline() const
+		{
+			return (static_cast<uint128_t>(case_status) << 64) | deadline;
+		}
 		
 		EOSLIB_SERIALIZE(casefile, (case_id)(case_status)(claimant)(respondant)(arbitrators)(approvals)
-		(required_langs)(unread_claims)(accepted_claims)(case_ruling)(last_edit))
+		(required_langs)(accepted_claims)(case_ruling)(last_edit)(filed_time)(deadline))
+	};
+
+	/**
+   * Compact summaries of RESOLVED and DISMISSED cases, moved out of casefiles by archivecases.
+   * @scope get_self().value
+   * @key case_id
+   */
+	struct [[eosio::table]] archived_case
+	{
+		uint64_t case_id;
+		uint8_t case_status;
+		name claimant;
+		name respondant;
+		checksum256 ruling_hash; //NOTE: sha2-256 digest of the ruling document, zero when the case closed without one
+		uint32_t filed_time;
+		uint32_t closed_time;
+		vector<uint64_t> accepted_claims; //NOTE: claims can only be added during CASE_SETUP, so at most MAX_UNREAD_CLAIMS ids
+
+		uint64_t primary_key() const { return case_id; }
+		EOSLIB_SERIALIZE(archived_case, (case_id)(case_status)(claimant)(respondant)(ruling_hash)
+		(filed_time)(closed_time)(accepted_claims))
 	};
 
 	/**
@@ -364,10 +536,18 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 		uint32_t last_time_edited;
 		uint64_t current_ballot_id = 0;
 		bool auto_start_election = false;
+		uint8_t arbs_per_case = 0;
+		uint8_t election_phase = 0;
+		uint64_t election_cursor = 0;
+		int64_t election_cutoff = 0; //NOTE: winners have more votes than this, -1 when all candidates fit
+		uint16_t occupied_seats = 0; //NOTE: arbitrators rows not SEAT_EXPIRED
+		vector<uint32_t> case_deadlines; //NOTE: seconds allowed per case_state, missing or 0 means no deadline
 
 		uint64_t primary_key() const { return publisher.value; }
 		EOSLIB_SERIALIZE(config, (publisher)(max_elected_arbs)(election_duration)(election_start)
-		    (fee_structure)(arb_term_length)(last_time_edited)(current_ballot_id)(auto_start_election))
+		    (fee_structure)(arb_term_length)(last_time_edited)(current_ballot_id)(auto_start_election)
+		    (arbs_per_case)(election_phase)(election_cursor)(election_cutoff)(occupied_seats)
+		    (case_deadlines))
 	};
 
 	/**
@@ -386,6 +566,76 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 		EOSLIB_SERIALIZE(joinder, (join_id)(cases)(join_time)(joined_by))
 	};
 
+	/**
+   * Holds one row per arbitrator assigned to an open case.
+   * @scope get_self().value
+   * @key uint64_t assignment_id
+   * @index byarbcase (arb << 64 | case_id), bycasearb (case_id << 64 | arb)
+   */
+	struct [[eosio::table]] assignment
+	{
+		uint64_t assignment_id;
+		name arb;
+		uint64_t case_id;
+		uint32_t assigned_time;
+
+		uint64_t primary_key() const { return assignment_id; }
+
+		uint128_t by_arbcase() const
+		{
+			return (static_cast<uint128_t>(arb.value) << 64) | case_id;
+		}
+		uint128_t by_casearb() const
+		{
+			return (static_cast<uint128_t>(case_id) << 64) | arb.value;
+		}
+
+		EOSLIB_SERIALIZE(assignment, (assignment_id)(arb)(case_id)(assigned_time))
+	};
+
+	/**
+   * Dismissed arbitrators whose open cases are still being cleaned up.
+   * @scope get_self().value
+   * @key arb
+   */
+	struct [[eosio::table]] arb_cleanup
+	{
+		name arb;
+		uint32_t queued_time;
+
+		uint64_t primary_key() const { return arb.value; }
+		EOSLIB_SERIALIZE(arb_cleanup, (arb)(queued_time))
+	};
+
+	/**
+   * Accounts currently holding a seat (AVAILABLE or UNAVAILABLE), kept sorted.
+   * dirty is set when members changed since eosio.arb@major was last updated.
+   * @scope get_self().value
+   */
+	struct [[eosio::table]] arb_perms
+	{
+		vector<name> members;
+		bool dirty = false;
+
+		EOSLIB_SERIALIZE(arb_perms, (members)(dirty))
+	};
+
+	/**
+   * Running totals for dashboards, updated on every case transition.
+   * @scope get_self().value
+   */
+	struct [[eosio::table]] arb_stats
+	{
+		vector<uint64_t> cases_by_status; //NOTE: cases currently in each case_state, indexed by case_state
+		vector<uint64_t> decisions_by_class; //NOTE: accepted claims, indexed by claim_class
+		asset fees_collected = asset(0, native_sym);
+		uint64_t closed_cases = 0;
+		uint64_t total_resolution_time = 0; //NOTE: seconds from filing to RESOLVED or DISMISSED, summed over closed_cases
+
+		EOSLIB_SERIALIZE(arb_stats, (cases_by_status)(decisions_by_class)(fees_collected)(closed_cases)
+		    (total_resolution_time))
+	};
+
 	struct [[eosio::table("accounts")]] account
 	{
 		asset balance;
@@ -396,50 +646,138 @@ class[[eosio::contract("eosio.arbitration")]] arbitration : public eosio::contra
 
 	typedef multi_index<"nominees"_n, nominee> nominees_table;
 
-	typedef multi_index<"arbitrators"_n, arbitrator> arbitrators_table;
+	typedef multi_index<"arbitrators"_n, arbitrator,
+		indexed_by<"bylangs"_n, const_mem_fun<arbitrator, uint64_t, &arbitrator::by_langs>>,
+		indexed_by<"byexpiration"_n, const_mem_fun<arbitrator, uint64_t, &arbitrator::by_expiration>>
+	> arbitrators_table;
+
+	typedef multi_index<"casefiles"_n, casefile,
+		indexed_by<"byclaimant"_n, const_mem_fun<casefile, uint64_t, &casefile::by_claimant>>,
+		indexed_by<"byrespondant"_n, const_mem_fun<casefile, uint64_t, &casefile::by_respondant>>,
+		indexed_by<"byuuid"_n, const_mem_fun<casefile, uint128_t, &casefile::by_uuid>>,
+		indexed_by<"bystatus"_n, const_mem_fun<casefile, uint64_t, &casefile::by_status>>,
+		indexed_by<"bydeadline"_n, const_mem_fun<casefile, uint128_t, &casefile::by_deadline>>
+	> casefiles_table;
+
+	typedef multi_index<"archives"_n, archived_case> archives_table;
 
-	typedef multi_index<"casefiles"_n, casefile> casefiles_table;
+	typedef multi_index<"assignments"_n, assignment,
+		indexed_by<"byarbcase"_n, const_mem_fun<assignment, uint128_t, &assignment::by_arbcase>>,
+		indexed_by<"bycasearb"_n, const_mem_fun<assignment, uint128_t, &assignment::by_casearb>>
+	> assignments_table;
+
+	typedef multi_index<"arbcleanup"_n, arb_cleanup> arb_cleanups_table;
 
 	typedef multi_index<"joinedcases"_n, joinder> joinders_table;
 
 	typedef multi_index<"claims"_n, claim> claims_table;
 
+	typedef multi_index<"unreadclaims"_n, claim> unread_claims_table;
+
+	typedef multi_index<"claimindex"_n, claim_ref,
+		indexed_by<"byhash"_n, const_mem_fun<claim_ref, checksum256, &claim_ref::by_hash>>,
+		indexed_by<"bycasehash"_n, const_mem_fun<claim_ref, checksum256, &claim_ref::by_case_hash>>
+	> claim_refs_table;
+
 	typedef multi_index<"accounts"_n, account> accounts_table;
 
 	typedef singleton<name("config"), config> config_singleton;
+
+	typedef singleton<name("arbperms"), arb_perms> arb_perms_singleton;
+
+	typedef singleton<name("stats"), arb_stats> stats_singleton;
 	config_singleton configs;
-	config _config;
+	std::optional<config> _config; //NOTE: loaded on first use, access through get_config()
+	vector<char> _config_snapshot;
+	bool _config_existed = false;
+	std::optional<arb_stats> _stats; //NOTE: loaded on first use, access through get_stats()
 
-	using exec_claim = action_wrapper<"execclaim"_n, &arbitration::execclaim>;
-	using exec_file = action_wrapper<"execfile"_n, &arbitration::execfile>;
+	using arb_event = action_wrapper<"arbevent"_n, &arbitration::arbevent>;
 
 #pragma endregion Tables and Structs
 
 #pragma region Helpers
 
+	config& get_config();
+
+	arb_stats& get_stats();
+
 	config get_default_config();
 
-	void validate_ipfs_url(string ipfs_url);
+	ipfs_cid to_cid(string ipfs_url);
+
+	string to_ipfs_url(const ipfs_cid& cid);
 
 	void assert_string(string to_check, string error_msg);
 
+	uint16_t to_lang_mask(const vector<uint8_t>& lang_codes);
+
+	uint32_t get_deadline(uint8_t case_status);
+
+	uint64_t create_case(name claimant, const vector<string>& claim_links, uint16_t langs, name respondant, name ram_payer);
+
+	void ready_case(casefiles_table& casefiles, const casefile& cf);
+
+	void file_from_memo(name claimant, asset quantity, const string& memo);
+
+	vector<string> split(const string& str, char delim);
+
+	void track_case(uint8_t from_status, uint8_t to_status, uint32_t filed_time = 0);
+
+	void track_decisions(const vector<uint8_t>& decision_classes);
+
+	void track_fee(asset fee);
+
+	void emit_event(uint8_t event_type, uint64_t case_id, uint8_t case_status, name actor, uint64_t ref_id = 0);
+
 	void start_new_election(uint8_t available_seats);
 
+	int64_t get_election_cutoff(const leaderboard& board);
+
 	bool has_available_seats(arbitrators_table & arbitrators, uint8_t & available_seats);
 
 	bool is_arb(name account);
 
-	void add_arbitrator(arbitrators_table & arbitrators, name arb_name, std::string credential_link);
+	void add_arbitrator(arbitrators_table & arbitrators, name arb_name, ipfs_cid credential_link);
+
+	void del_claim(uint64_t case_id, uint64_t claim_id);
+
+	void del_unread_claims(uint64_t case_id);
+
+	void add_assignment(uint64_t case_id, name arb);
+
+	void del_assignment(uint64_t case_id, name arb, bool closed);
+
+	void close_assignments(const casefile& cf);
+
+	uint32_t drop_approval(uint32_t approvals, size_t panel_pos);
 
-	void del_claim(uint64_t claim_id);
+	bool clean_arb_cases(name arb, uint16_t& budget);
 
-	vector<permission_level_weight> get_arb_permissions();
+	vector<name> select_arbitrators(const casefile& cf, uint8_t num_arbs);
+
+	uint8_t assign_arbitrators(casefiles_table& casefiles, const casefile& cf, uint8_t num_arbs);
+
+	void seat_arbitrators(const casefile& cf, const vector<name>& arbs);
+
+	arb_perms get_arb_perms();
+
+	void sync_arb_perms(name arb, uint8_t arb_status);
+
+	void flush_arb_perms();
 
 	void set_permissions(vector<permission_level_weight> &perms);
 
-	vector<claim>::iterator get_claim_at(string claim_hash, vector<claim>& claims);
+	unread_claims_table::const_iterator get_claim_at(const ipfs_cid& claim_hash, unread_claims_table& claims);
+
+	checksum256 to_doc_hash(const ipfs_cid& cid);
+
+	claim_refs_table::const_iterator find_claim_ref(claim_refs_table& claim_refs, const ipfs_cid& cid, uint64_t case_id,
+		bool accepted);
+
+	void add_claim_ref(const ipfs_cid& cid, uint64_t case_id, uint64_t claim_id, bool accepted, name ram_payer);
 
-	void del_claim_at(const string claim_hash, vector<claim> claims);
+	void erase_claim_ref(const ipfs_cid& cid, uint64_t case_id, bool accepted);
 
 	[[eosio::on_notify("eosio.token::transfer")]]
 	void transfer_handler(name from, name to, asset quantity, string memo);
@@ -10,12 +10,22 @@
 arbitration::arbitration(name s, name code, datastream<const char *> ds) : eosio::contract(s, code, ds),
 																		   configs(_self, _self.value)
 {
-	_config = configs.exists() ? configs.get() : get_default_config();
 }
 
 arbitration::~arbitration()
 {
-	configs.set(_config, get_self());
+	//NOTE: config is only written back if an action loaded it and changed it
+	if (_config && (!_config_existed || pack(*_config) != _config_snapshot))
+	{
+		configs.set(*_config, get_self());
+	}
+
+	//NOTE: every stats update in an action lands in a single write
+	if (_stats)
+	{
+		stats_singleton stats(get_self(), get_self().value);
+		stats.set(*_stats, get_self());
+	}
 }
 
 void arbitration::setconfig(uint16_t max_elected_arbs, uint32_t election_duration,
@@ -23,8 +33,17 @@ void arbitration::setconfig(uint16_t max_elected_arbs, uint32_t election_duratio
 {
 	require_auth("eosio"_n);
 	check(max_elected_arbs > uint16_t(0), "Arbitrators must be greater than 0");
+	check(get_config().election_phase == PHASE_IDLE, "an election is being finalized, call endelection until it completes");
+
+	//NOTE: recounted on every setconfig so the counter is seeded from the seats actually held,
+	// expired seats sit at the end of byexpiration so only held seats are visited
+	arbitrators_table arbitrators(get_self(), get_self().value);
+	auto by_expiration = arbitrators.get_index<"byexpiration"_n>();
+	uint16_t occupied_seats = 0;
+	for (auto itr = by_expiration.begin(); itr != by_expiration.end() && itr->arb_status != SEAT_EXPIRED; itr++)
+		occupied_seats++;
 
-	_config = config {
+	get_config() = config {
 		get_self(),		   		//publisher
 		max_elected_arbs,  		//max_elected_arbs
 		election_duration, 		//election_duration
@@ -32,21 +51,46 @@ void arbitration::setconfig(uint16_t max_elected_arbs, uint32_t election_duratio
 		fees,			   		//fee_structure
 		arbitrator_term_length,
 		current_time_point().sec_since_epoch(),
-		_config.current_ballot_id,
-		_config.auto_start_election
+		get_config().current_ballot_id,
+		get_config().auto_start_election,
+		get_config().arbs_per_case,
+		get_config().election_phase,
+		get_config().election_cursor,
+		get_config().election_cutoff,
+		occupied_seats,
+		get_config().case_deadlines
 	};
 }
 
+void arbitration::setpanelsize(uint8_t arbs_per_case)
+{
+	require_auth("eosio"_n);
+	check(arbs_per_case <= MAX_PANEL_SIZE, "arbs_per_case exceeds the max panel size");
+
+	get_config().arbs_per_case = arbs_per_case;
+	get_config().last_time_edited = current_time_point().sec_since_epoch();
+}
+
+void arbitration::setdeadlines(vector<uint32_t> case_deadlines)
+{
+	require_auth("eosio"_n);
+	check(case_deadlines.size() <= RESOLVED, "deadlines can only be set for states before RESOLVED");
+
+	get_config().case_deadlines = case_deadlines;
+	get_config().last_time_edited = current_time_point().sec_since_epoch();
+}
+
 #pragma region Arb_Elections
 
 void arbitration::initelection()
 {
 	require_auth("eosio"_n);
-	check(!_config.auto_start_election, "Election is on auto start mode.");
+	check(!get_config().auto_start_election, "Election is on auto start mode.");
+	check(get_config().election_phase == PHASE_IDLE, "an election is being finalized, call endelection until it completes");
 
 	ballots_table ballots("eosio.trail"_n, "eosio.trail"_n.value);
-	_config.current_ballot_id = ballots.available_primary_key();
-	_config.auto_start_election = true;
+	get_config().current_ballot_id = ballots.available_primary_key();
+	get_config().auto_start_election = true;
 
 	arbitrators_table arbitrators(get_self(), get_self().value);
 
@@ -60,7 +104,8 @@ void arbitration::initelection()
 void arbitration::regarb(name nominee, string credentials_link)
 {
 	require_auth(nominee);
-	validate_ipfs_url(credentials_link);
+	auto credentials_cid = to_cid(credentials_link);
+	check(get_config().election_phase == PHASE_IDLE, "an election is being finalized, call endelection until it completes");
 
 	nominees_table nominees(get_self(), get_self().value);
 	auto nom_itr = nominees.find(nominee.value);
@@ -74,14 +119,22 @@ void arbitration::regarb(name nominee, string credentials_link)
 		check(current_time_point().sec_since_epoch() > arb_itr->term_expiration, "Nominee is already an Arbitrator and the seat hasn't expired");
 
 		//NOTE: set arb_status to SEAT_EXPIRED until re-election
-		arbitrators.modify(arb_itr, same_payer, [&](auto &row) {
-			row.arb_status = SEAT_EXPIRED;
-		});
+		if (arb_itr->arb_status != SEAT_EXPIRED)
+		{
+			arbitrators.modify(arb_itr, same_payer, [&](auto &row) {
+				row.arb_status = SEAT_EXPIRED;
+			});
+			sync_arb_perms(nominee, SEAT_EXPIRED);
+			flush_arb_perms();
+
+			if (get_config().occupied_seats > 0)
+				get_config().occupied_seats--;
+		}
 	}
 
 	nominees.emplace(get_self(), [&](auto &row) {
 		row.nominee_name = nominee;
-		row.credentials_link = credentials_link;
+		row.credentials_link = credentials_cid;
 		row.application_time = current_time_point().sec_since_epoch();
 	});
 }
@@ -94,14 +147,11 @@ void arbitration::unregnominee(name nominee)
 	auto nom_itr = nominees.find(nominee.value);
 	check(nom_itr != nominees.end(), "Nominee isn't an applicant");
 
-	ballots_table ballots("eosio.trail"_n, "eosio.trail"_n.value);
-	auto bal = ballots.get(_config.current_ballot_id, "Ballot doesn't exist");
+	ballotheaders_table headers("eosio.trail"_n, "eosio.trail"_n.value);
+	const auto& header = headers.get(get_config().current_ballot_id, "Ballot doesn't exist");
 
-	leaderboards_table leaderboards("eosio.trail"_n, "eosio.trail"_n.value);
-	auto board = leaderboards.get(bal.reference_id, "Leaderboard doesn't exist");
-
-	if (_config.auto_start_election)
-		check(current_time_point().sec_since_epoch() < board.begin_time, "Cannot unregister while election is in progress");
+	if (get_config().auto_start_election)
+		check(current_time_point().sec_since_epoch() < header.begin_time, "Cannot unregister while election is in progress");
 
 	nominees.erase(nom_itr);
 }
@@ -109,23 +159,21 @@ void arbitration::unregnominee(name nominee)
 void arbitration::candaddlead(name nominee, string credentials_link)
 {
 	require_auth(nominee);
-	validate_ipfs_url(credentials_link);
-	check(_config.auto_start_election, "there is no active election");
+	to_cid(credentials_link); //NOTE: trail keeps the text form as the candidate info_link
+	check(get_config().auto_start_election, "there is no active election");
+	check(get_config().election_phase == PHASE_IDLE, "an election is being finalized, call endelection until it completes");
 
 	nominees_table nominees(get_self(), get_self().value);
 	auto nom_itr = nominees.find(nominee.value);
 	check(nom_itr != nominees.end(), "Nominee isn't an applicant. Use regarb action to register as a nominee");
 
-	ballots_table ballots("eosio.trail"_n, "eosio.trail"_n.value);
-	auto bal = ballots.get(_config.current_ballot_id, "Ballot doesn't exist");
-
-	leaderboards_table leaderboards("eosio.trail"_n, "eosio.trail"_n.value);
-	auto board = leaderboards.get(bal.reference_id, "Leaderboard doesn't exist");
-	check(board.status != CLOSED, "A new election hasn't started. Use initelection action to start a new election.");
+	ballotheaders_table headers("eosio.trail"_n, "eosio.trail"_n.value);
+	const auto& header = headers.get(get_config().current_ballot_id, "Ballot doesn't exist");
+	check(header.status != CLOSED, "A new election hasn't started. Use initelection action to start a new election.");
 
 	action(permission_level{get_self(), "active"_n}, "eosio.trail"_n, "addcandidate"_n,
 		   make_tuple(get_self(),
-					  _config.current_ballot_id,
+					  get_config().current_ballot_id,
 					  nominee,
 					  credentials_link))
 		.send();
@@ -143,7 +191,7 @@ void arbitration::candrmvlead(name nominee)
 
 	action(permission_level{get_self(), "active"_n}, "eosio.trail"_n, "rmvcandidate"_n,
 		   make_tuple(get_self(),
-					  _config.current_ballot_id,
+					  get_config().current_ballot_id,
 					  nominee))
 		.send();
 
@@ -154,129 +202,172 @@ void arbitration::endelection(name nominee) //NOTE: required eosio.arb@eosio.cod
 {
 	require_auth(nominee);
 
-	ballots_table ballots("eosio.trail"_n, "eosio.trail"_n.value);
-	auto bal = ballots.get(_config.current_ballot_id, "Ballot doesn't exist");
+	//NOTE: the full leaderboard with its candidate list is only read while seating winners
+	ballotheaders_table headers("eosio.trail"_n, "eosio.trail"_n.value);
+	const auto& header = headers.get(get_config().current_ballot_id, "Ballot doesn't exist");
 
+	nominees_table nominees(get_self(), get_self().value);
+	arbitrators_table arbitrators(get_self(), get_self().value);
 	leaderboards_table leaderboards("eosio.trail"_n, "eosio.trail"_n.value);
-	auto board = leaderboards.get(bal.reference_id, "Leaderboard doesn't exist");
-	check(current_time_point().sec_since_epoch() > board.end_time,
-		  std::string("Election hasn't ended. Please check again after the election is over in " + std::to_string(uint32_t(board.end_time - current_time_point().sec_since_epoch()))
-					  + " seconds")
-			  .c_str());
-
-	//sort board candidates by votes
-	auto board_candidates = board.candidates;
-	sort(board_candidates.begin(), board_candidates.end(), [](const auto &c1, const auto &c2) { return c1.votes > c2.votes; });
-
-	//resolve tie clonficts
-	if (board_candidates.size() > board.available_seats)
+
+	//NOTE: only the first call validates, later calls resume from config and can be pushed by anyone
+	if (get_config().election_phase == PHASE_IDLE)
 	{
-		auto first_cand_out = board_candidates[board.available_seats];
-		board_candidates.resize(board.available_seats);
+		check(current_time_point().sec_since_epoch() > header.end_time,
+			  std::string("Election hasn't ended. Please check again after the election is over in " + std::to_string(uint32_t(header.end_time - current_time_point().sec_since_epoch()))
+						  + " seconds")
+				  .c_str());
 
-		//count candidates that are tied with first_cand_out
-		uint8_t tied_cands = 0;
-		for (int i = board_candidates.size() - 1; i >= 0; i--)
-		{
-			if (board_candidates[i].votes == first_cand_out.votes)
-				tied_cands++;
-		}
+		auto nom_itr = nominees.find(nominee.value);
+		check(nom_itr != nominees.end(), "Nominee isn't an applicant.");
 
-		//remove all tied candidates
-		if (tied_cands > 0)
-			board_candidates.resize(board_candidates.size() - tied_cands);
+		get_config().election_phase = PHASE_SEAT;
+		get_config().election_cursor = 0;
+		get_config().election_cutoff = get_election_cutoff(leaderboards.get(header.reference_id, "Leaderboard doesn't exist"));
 	}
 
-	nominees_table nominees(get_self(), get_self().value);
-	auto nom_itr = nominees.find(nominee.value);
-	check(nom_itr != nominees.end(), "Nominee isn't an applicant.");
+	uint8_t budget = MAX_ELECTION_BATCH;
 
-	arbitrators_table arbitrators(get_self(), get_self().value);
-	std::vector<permission_level_weight> arbs_perms;
-
-	//in case there are still candidates (not all tied)
-	if (board_candidates.size() > 0)
+	if (get_config().election_phase == PHASE_SEAT)
 	{
-		for (int i = 0; i < board_candidates.size(); i++)
-		{
-			name cand_name = board_candidates[i].member;
-			auto c = nominees.find(cand_name.value);
+		const auto& board = leaderboards.get(header.reference_id, "Leaderboard doesn't exist");
+		tallies_table tallies("eosio.trail"_n, board.board_id);
 
-			if (c != nominees.end())
-			{
-				auto cand_credential = board_candidates[i].info_link;
-				auto cand_votes = board_candidates[i].votes;
-				auto threshold_votes = asset(MIN_VOTE_THRESHOLD, cand_votes.symbol);
-				print("\ncand_votes: ", cand_votes);
-				print("\nthreshold_votes: ", threshold_votes);
-				if (cand_votes < threshold_votes) {
-					print("\nskipping candidate: ", cand_name, " because they have no votes");
-					continue;
-				}
-					
+		//NOTE: candidates are visited in board order, the cutoff already decided who won
+		while (get_config().election_cursor < board.candidates.size() && budget > 0)
+		{
+			const auto &cand = board.candidates[get_config().election_cursor];
+			auto tally_itr = tallies.find(get_config().election_cursor);
+			int64_t votes = cand.votes.amount + (tally_itr == tallies.end() ? 0 : tally_itr->votes);
+			get_config().election_cursor++;
+			budget--;
 
-				//remove candidates from candidates table / arbitration contract
-				nominees.erase(c);
+			if (votes <= get_config().election_cutoff)
+				continue;
 
-				//add candidates to arbitration table / arbitration contract
-				add_arbitrator(arbitrators, cand_name, cand_credential);
+			auto c = nominees.find(cand.member.value);
+			if (c == nominees.end())
+			{
+				print("\ncandidate: ", cand.member, " was not found.");
+				continue;
 			}
-			else
+
+			if (votes < MIN_VOTE_THRESHOLD)
 			{
-				print("\ncandidate: ", cand_name, " was not found.");
+				print("\nskipping candidate: ", cand.member, " because they have no votes");
+				continue;
 			}
+
+			//remove candidates from candidates table / arbitration contract
+			nominees.erase(c);
+
+			//add candidates to arbitration table / arbitration contract
+			add_arbitrator(arbitrators, cand.member, to_cid(cand.info_link));
 		}
 
-		//add current arbitrators to permission list
-		for (const auto &a : arbitrators)
+		if (get_config().election_cursor >= board.candidates.size())
 		{
-			if (a.arb_status != SEAT_EXPIRED || a.arb_status != REMOVED)
-			{
-				arbs_perms.emplace_back(permission_level_weight{permission_level{a.arb, "active"_n}, 1});
-			}
+			get_config().election_phase = PHASE_PERMS;
+			get_config().election_cursor = 0;
+			get_config().election_cutoff = 0;
 		}
+	}
 
-		set_permissions(arbs_perms);
+	if (get_config().election_phase == PHASE_PERMS && budget > 0)
+	{
+		flush_arb_perms();
+
+		budget--;
+		get_config().election_phase = PHASE_CLOSE;
 	}
 
-	//close ballot action.
-	action(permission_level{get_self(), "active"_n}, "eosio.trail"_n, "closeballot"_n,
-		   make_tuple(
-			   get_self(),
-			   _config.current_ballot_id,
-			   CLOSED))
-		.send();
+	if (get_config().election_phase == PHASE_CLOSE && budget > 0)
+	{
+		//close ballot action.
+		action(permission_level{get_self(), "active"_n}, "eosio.trail"_n, "closeballot"_n,
+			   make_tuple(
+				   get_self(),
+				   get_config().current_ballot_id,
+				   CLOSED))
+			.send();
 
-	//start new election with remaining candidates
-	//and new candidates that registered after past election had started.
-	uint8_t available_seats = 0;
-	auto remaining_candidates = distance(nominees.begin(), nominees.end());
-	print("\nremaining_cands: ", remaining_candidates);
-	if (remaining_candidates > 0 && has_available_seats(arbitrators, available_seats))
+		budget--;
+
+		//start new election with remaining candidates
+		//and new candidates that registered after past election had started.
+		uint8_t available_seats = 0;
+		if (nominees.begin() != nominees.end() && has_available_seats(arbitrators, available_seats))
+		{
+			ballots_table ballots("eosio.trail"_n, "eosio.trail"_n.value);
+			get_config().current_ballot_id = ballots.available_primary_key();
+
+			start_new_election(available_seats);
+
+			get_config().election_phase = PHASE_CARRY;
+			get_config().election_cursor = 0;
+			//print("\nA new election has started.");
+		}
+		else
+		{
+			get_config().election_phase = PHASE_CLEAR;
+		}
+	}
+
+	//NOTE: nominees are handed over a page at a time, each page is a single addcands write on trail
+	if (get_config().election_phase == PHASE_CARRY)
 	{
-		_config.current_ballot_id = ballots.available_primary_key();
+		//NOTE: the new ballot is registered inline, so the call that opened it has no header to read yet
+		uint32_t now = current_time_point().sec_since_epoch();
+		auto new_header = headers.find(get_config().current_ballot_id);
+		uint32_t begin_time = new_header == headers.end() ? now + get_config().election_start : new_header->begin_time;
 
-		start_new_election(available_seats);
+		//NOTE: trail refuses candidates once voting has begun, nominees left over stay registered for the next election
+		if (now >= begin_time)
+		{
+			print("\nthe new ballot is already open, the remaining nominees were not carried");
+			get_config().election_phase = PHASE_IDLE;
+			get_config().election_cursor = 0;
+		}
+	}
+
+	if (get_config().election_phase == PHASE_CARRY)
+	{
+		vector<candidate> page;
+		auto itr = nominees.lower_bound(get_config().election_cursor);
+		for (; itr != nominees.end() && budget > 0; itr++, budget--)
+		{
+			page.push_back(candidate{itr->nominee_name, to_ipfs_url(itr->credentials_link), asset(0, symbol("VOTE", 4)), 0});
+			get_config().election_cursor = itr->nominee_name.value + 1;
+		}
 
-		for (const auto &c : nominees)
+		if (!page.empty())
 		{
-			action(permission_level{get_self(), "active"_n}, "eosio.trail"_n, "addcandidate"_n,
-				   make_tuple(
-					   get_self(),
-					   _config.current_ballot_id,
-					   c,
-					   c.credentials_link))
+			action(permission_level{get_self(), "active"_n}, "eosio.trail"_n, "addcands"_n,
+				   make_tuple(get_self(),
+							  get_config().current_ballot_id,
+							  page))
 				.send();
 		}
 
-		//print("\nA new election has started.");
+		if (itr == nominees.end())
+		{
+			get_config().election_phase = PHASE_IDLE;
+			get_config().election_cursor = 0;
+		}
 	}
-	else
+
+	if (get_config().election_phase == PHASE_CLEAR)
 	{
-		for (auto i = nominees.begin(); i != nominees.end(); i = nominees.erase(i))
-			;
-		_config.auto_start_election = false;
-		//print("\nThere aren't enough seats available or candidates to start a new election.\nUse init action to start a new election.");
+		auto itr = nominees.begin();
+		for (; itr != nominees.end() && budget > 0; budget--)
+			itr = nominees.erase(itr);
+
+		if (itr == nominees.end())
+		{
+			get_config().auto_start_election = false;
+			get_config().election_phase = PHASE_IDLE;
+			//print("\nThere aren't enough seats available or candidates to start a new election.\nUse init action to start a new election.");
+		}
 	}
 }
 
@@ -304,63 +395,56 @@ void arbitration::withdraw(name owner) //NOTE: requires eosio.arb@eosio.code
 void arbitration::filecase(name claimant, string claim_link, vector<uint8_t> lang_codes, std::optional<name> respondant)
 {
 	require_auth(claimant);
-	validate_ipfs_url(claim_link);
+	create_case(claimant, {claim_link}, to_lang_mask(lang_codes), respondant.value_or(name(0)), claimant);
+}
 
-	casefiles_table casefiles(get_self(), get_self().value);
-	print("respondant: ", *respondant);
-	if(respondant) {
-		check(is_account(*respondant), "respondant must be an account");
-	}
+void arbitration::fileready(name claimant, vector<string> claim_links, vector<uint8_t> lang_codes,
+		std::optional<name> respondant)
+{
+	require_auth(claimant);
 
-	vector<claim> unr_claims = {claim{uint64_t(0), claim_link, ""}};
-	uint64_t new_case_id = casefiles.available_primary_key();
+	auto case_id = create_case(claimant, claim_links, to_lang_mask(lang_codes), respondant.value_or(name(0)), claimant);
 
-	casefiles.emplace(claimant, [&](auto &row) {
-		row.case_id = new_case_id;
-		row.case_status = CASE_SETUP;
-		row.claimant = claimant;
-		row.respondant = *respondant;
-		row.arbitrators = {};
-		row.approvals = {};
-		row.required_langs = lang_codes;
-		row.unread_claims = unr_claims;
-		row.accepted_claims = {};
-		row.case_ruling = std::string("");
-		row.last_edit = current_time_point().sec_since_epoch();
-	});
-
-	exec_file exec("eosio.arb"_n, {get_self(), "active"_n});
-	exec.send(new_case_id, claimant, claim_link, lang_codes, *respondant);
+	casefiles_table casefiles(get_self(), get_self().value);
+	ready_case(casefiles, casefiles.get(case_id));
 }
 
-void arbitration::execfile(uint64_t new_case_id, name claimant, string claim_link,
-			  vector<uint8_t> lang_codes, name respondant) {
-	require_auth(get_self());
+void arbitration::addclaim(uint64_t case_id, string claim_link, name claimant)
+{
+	addclaims(case_id, {claim_link}, claimant);
 }
 
-void arbitration::addclaim(uint64_t case_id, string claim_link, name claimant)
+void arbitration::addclaims(uint64_t case_id, vector<string> claim_links, name claimant)
 {
 	require_auth(claimant);
-	validate_ipfs_url(claim_link);
+	check(!claim_links.empty(), "claim_links cannot be empty");
 
 	casefiles_table casefiles(get_self(), get_self().value);
 	const auto& cf = casefiles.get(case_id, "Case Not Found");
 
 	check(cf.case_status == CASE_SETUP, "claims cannot be added after CASE_SETUP is complete.");
 
-	auto new_claims = cf.unread_claims;
+	unread_claims_table unread_claims(get_self(), case_id);
 
-	check(new_claims.size() < MAX_UNREAD_CLAIMS, "case file has reached maximum number of claims");
+	check(std::distance(unread_claims.begin(), unread_claims.end()) + claim_links.size() <= MAX_UNREAD_CLAIMS,
+		"case file has reached maximum number of claims");
 	check(claimant == cf.claimant, "you are not the claimant of this case.");
-	auto claim_it = get_claim_at(claim_link, new_claims);
-	check(claim_it == new_claims.end(), "ipfs hash exists in another claim");
 
-	claim new_claim = claim{ uint64_t(0), claim_link, "" };
-	
-	new_claims.emplace_back(new_claim);
-	casefiles.modify(cf, same_payer, [&](auto &row) {
-		row.unread_claims = new_claims;
-	});
+	uint64_t new_claim_id = unread_claims.available_primary_key();
+	for (const auto& claim_link : claim_links)
+	{
+		auto claim_cid = to_cid(claim_link);
+		auto claim_it = get_claim_at(claim_cid, unread_claims);
+		check(claim_it == unread_claims.end(), "ipfs hash exists in another claim");
+
+		unread_claims.emplace(claimant, [&](auto &row) {
+			row.claim_id = new_claim_id;
+			row.claim_summary = claim_cid;
+		});
+		add_claim_ref(claim_cid, case_id, new_claim_id, false, claimant);
+
+		emit_event(CLAIM_ADDED, case_id, cf.case_status, claimant, new_claim_id++);
+	}
 }
 
 void arbitration::removeclaim(uint64_t case_id, string claim_hash, name claimant)
@@ -370,20 +454,19 @@ void arbitration::removeclaim(uint64_t case_id, string claim_hash, name claimant
 	casefiles_table casefiles(get_self(), get_self().value);
 	const auto& cf = casefiles.get(case_id, "Case Not Found");
 	check(cf.case_status == CASE_SETUP, "Claims cannot be removed after CASE_SETUP is complete");
-	check(cf.unread_claims.size() > 0, "No claims to remove");
-	check(claimant == cf.claimant, "you are not the claimant of this case.");
-
-	auto new_claims = cf.unread_claims;
 
-	auto claim_it = get_claim_at(claim_hash, new_claims);
-	check(claim_it != new_claims.end(), "Claim Hash not found in casefile");
-	new_claims.erase(claim_it);
+	unread_claims_table unread_claims(get_self(), case_id);
+	check(unread_claims.begin() != unread_claims.end(), "No claims to remove");
+	check(claimant == cf.claimant, "you are not the claimant of this case.");
 
-	casefiles.modify(cf, same_payer, [&](auto &row) {
-		row.unread_claims = new_claims;
-	});
+	auto claim_cid = to_cid(claim_hash);
+	auto claim_it = get_claim_at(claim_cid, unread_claims);
+	check(claim_it != unread_claims.end(), "Claim Hash not found in casefile");
+	auto claim_id = claim_it->claim_id;
+	unread_claims.erase(claim_it);
+	erase_claim_ref(claim_cid, case_id, false);
 
-	//print("\nClaim Removed");
+	emit_event(CLAIM_REMOVED, case_id, cf.case_status, claimant, claim_id);
 }
 
 void arbitration::shredcase(uint64_t case_id, name claimant)
@@ -396,7 +479,11 @@ void arbitration::shredcase(uint64_t case_id, name claimant)
 	check(claimant == c_itr->claimant, "you are not the claimant of this case.");
 	check(c_itr->case_status == CASE_SETUP, "cases can only be shredded during CASE_SETUP");
 
+	del_unread_claims(case_id);
 	casefiles.erase(c_itr);
+
+	track_case(CASE_SETUP, NO_STATUS);
+	emit_event(CASE_SHREDDED, case_id, CASE_SETUP, claimant);
 }
 
 void arbitration::readycase(uint64_t case_id, name claimant)
@@ -405,15 +492,11 @@ void arbitration::readycase(uint64_t case_id, name claimant)
 	casefiles_table casefiles(get_self(), get_self().value);
 	const auto& cf = casefiles.get(case_id, "Case Not Found");
 	check(cf.case_status == CASE_SETUP, "Cases can only be readied during CASE_SETUP");
-	check(cf.unread_claims.size() >= 1, "Cases must have atleast one claim");
+	unread_claims_table unread_claims(get_self(), case_id);
+	check(unread_claims.begin() != unread_claims.end(), "Cases must have atleast one claim");
 	check(claimant == cf.claimant, "you are not the claimant of this case.");
 
-	sub_balance(claimant, asset(_config.fee_structure[0], native_sym));
-
-	casefiles.modify(cf, get_self(), [&](auto &row) {
-		row.case_status = AWAITING_ARBS;
-		row.last_edit = current_time_point().sec_since_epoch();
-	});
+	ready_case(casefiles, cf);
 }
 
 #pragma endregion Case_Setup
@@ -423,7 +506,7 @@ void arbitration::readycase(uint64_t case_id, name claimant)
 void arbitration::respond(uint64_t case_id, string claim_hash, name respondant, string response_link)
 {
 	require_auth(respondant);
-	validate_ipfs_url(response_link);
+	auto response_cid = to_cid(response_link);
 
 	casefiles_table casefiles(get_self(), get_self().value);
 	const auto& cf = casefiles.get(case_id, "Case Not Found");
@@ -432,16 +515,16 @@ void arbitration::respond(uint64_t case_id, string claim_hash, name respondant,
 	check(cf.respondant == respondant, "must be the respondant of this case_id");
 	check(cf.case_status == CASE_INVESTIGATION, "case status does NOT allow responses at this time");
 
-	auto delta_claims = cf.unread_claims;
+	unread_claims_table unread_claims(get_self(), case_id);
     
-	auto claim_it = get_claim_at(claim_hash, delta_claims);
-	check(claim_it != delta_claims.end(), "claim does not exist in unread claims");
-
-	claim_it->response_link = response_link;
+	auto claim_it = get_claim_at(to_cid(claim_hash), unread_claims);
+	check(claim_it != unread_claims.end(), "claim does not exist in unread claims");
 
-	casefiles.modify(cf, same_payer, [&](auto& c) {
-		c.unread_claims = delta_claims;
+	unread_claims.modify(claim_it, same_payer, [&](auto& c) {
+		c.response_link = response_cid;
 	});
+
+	emit_event(CLAIM_RESPONDED, case_id, cf.case_status, respondant, claim_it->claim_id);
 }
 
 void arbitration::addarbs(uint64_t case_id, name assigned_arb, uint8_t num_arbs_to_assign)
@@ -452,10 +535,26 @@ void arbitration::addarbs(uint64_t case_id, name assigned_arb, uint8_t num_arbs_
 
 	auto arb_it = std::find(cf.arbitrators.begin(), cf.arbitrators.end(), assigned_arb);
 	check(arb_it != cf.arbitrators.end(), "arbitrator isn't assigned to this case_id");
+	check(num_arbs_to_assign > 0, "num_arbs_to_assign must be greater than 0");
+	check(cf.case_status < RESOLVED, "case file can not be RESOLVED or DISMISSED");
 
-	/* RATIONALE: If the following validations pass, the trx would be committed irreversible.
-	Demux service watch from calls to this action, a side effect of this action being call 
-	is to assigntocase N times. */
+	auto assigned = assign_arbitrators(casefiles, cf, num_arbs_to_assign);
+	check(assigned == num_arbs_to_assign, "not enough available arbitrators for this case");
+}
+
+void arbitration::assigncase(uint64_t case_id)
+{
+	auto arbs_per_case = get_config().arbs_per_case;
+	check(arbs_per_case > 0, "auto assignment is disabled");
+
+	casefiles_table casefiles(get_self(), get_self().value);
+	const auto& cf = casefiles.get(case_id, "Case not found with given Case ID");
+	check(cf.case_status >= AWAITING_ARBS, "case file is still in CASE_SETUP");
+	check(cf.case_status < RESOLVED, "case file can not be RESOLVED or DISMISSED");
+	check(cf.arbitrators.size() < arbs_per_case, "case panel is already full");
+
+	auto assigned = assign_arbitrators(casefiles, cf, uint8_t(arbs_per_case - cf.arbitrators.size()));
+	check(assigned > 0, "no available arbitrators for this case");
 }
 
 void arbitration::assigntocase(uint64_t case_id, name arb_to_assign)
@@ -467,13 +566,6 @@ void arbitration::assigntocase(uint64_t case_id, name arb_to_assign)
 	check(arb.arb_status != REMOVED, "Arbitrator has been removed.");
 	check(arb.arb_status == AVAILABLE, "Arb status isn't set to available, Arbitrator is unable to receive new cases");
 
-	vector<uint64_t> new_open_cases = arb.open_case_ids;
-	new_open_cases.emplace_back(case_id);
-
-	arbitrators.modify(arb, same_payer, [&](auto &row) {
-		row.open_case_ids = new_open_cases;
-	});
-
 	casefiles_table casefiles(get_self(), get_self().value);
 	const auto& cf = casefiles.get(case_id, "Case not found with given Case ID");
 	check(cf.case_status >= AWAITING_ARBS, "case file is still in CASE_SETUP");
@@ -482,23 +574,39 @@ void arbitration::assigntocase(uint64_t case_id, name arb_to_assign)
 	//check(cf.arbitrators.size() == size_t(0), "Case already has an assigned arbitrator");
 	check(std::find(cf.arbitrators.begin(), cf.arbitrators.end(), arb_to_assign) == cf.arbitrators.end(),
 		  "Arbitrator is already assigned to this case");
+	check(cf.arbitrators.size() < MAX_PANEL_SIZE, "case panel is full");
 
 	vector<name> new_arbs = cf.arbitrators;
 	new_arbs.emplace_back(arb.arb);
+	auto old_status = cf.case_status;
 
 	casefiles.modify(cf, same_payer, [&](auto &row) {
 		row.arbitrators = new_arbs;
 
 		if(cf.case_status == AWAITING_ARBS) {
 			row.case_status = CASE_INVESTIGATION;
+			row.deadline = get_deadline(CASE_INVESTIGATION);
 		}
+		row.last_edit = current_time_point().sec_since_epoch();
 	});
+
+	add_assignment(case_id, arb_to_assign);
+
+	if (old_status != cf.case_status) {
+		track_case(old_status, cf.case_status);
+	}
+	emit_event(ARB_ASSIGNED, case_id, cf.case_status, arb_to_assign);
 }
 
 void arbitration::dismissclaim(uint64_t case_id, name assigned_arb, string claim_hash, string memo)
+{
+	dismissclaims(case_id, assigned_arb, {claim_hash}, memo);
+}
+
+void arbitration::dismissclaims(uint64_t case_id, name assigned_arb, vector<string> claim_hashes, string memo)
 {
 	require_auth(assigned_arb);
-	validate_ipfs_url(claim_hash);
+	check(!claim_hashes.empty(), "claim_hashes cannot be empty");
 
 	casefiles_table casefiles(get_self(), get_self().value);
 	const auto& cf = casefiles.get(case_id, "Case not found");
@@ -509,24 +617,35 @@ void arbitration::dismissclaim(uint64_t case_id, name assigned_arb, string claim
 	check(arb_case != cf.arbitrators.end(), "Only an assigned arbitrator can dismiss a claim");
 
 	assert_string(memo, std::string("memo must be greater than 0 and less than 255"));
-	vector<claim> new_claims = cf.unread_claims;
+	unread_claims_table unread_claims(get_self(), case_id);
 
-	auto claim_it = get_claim_at(claim_hash, new_claims);
-	check(claim_it != new_claims.end(), "Claim Hash not found in casefile");
-	new_claims.erase(claim_it);
+	for (const auto& claim_hash : claim_hashes)
+	{
+		auto claim_cid = to_cid(claim_hash);
+		auto claim_it = get_claim_at(claim_cid, unread_claims);
+		check(claim_it != unread_claims.end(), "Claim Hash not found in casefile");
+		auto claim_id = claim_it->claim_id;
+		unread_claims.erase(claim_it);
+		erase_claim_ref(claim_cid, case_id, false);
+
+		emit_event(CLAIM_DISMISSED, case_id, cf.case_status, assigned_arb, claim_id);
+	}
 
 	casefiles.modify(cf, same_payer, [&](auto &cf) {
-		cf.unread_claims = new_claims;
 		cf.last_edit = current_time_point().sec_since_epoch();
 	});
 }
 
 void arbitration::acceptclaim(uint64_t case_id, name assigned_arb, string claim_hash,
 							  string decision_link, uint8_t decision_class)
+{
+	acceptclaims(case_id, assigned_arb, {claim_decision{claim_hash, decision_link, decision_class}});
+}
+
+void arbitration::acceptclaims(uint64_t case_id, name assigned_arb, vector<claim_decision> decisions)
 {
 	require_auth(assigned_arb);
-	validate_ipfs_url(claim_hash);
-	validate_ipfs_url(decision_link);
+	check(!decisions.empty(), "decisions cannot be empty");
 	
 	casefiles_table casefiles(get_self(), get_self().value);
 	const auto& cf = casefiles.get(case_id, "Case not found");
@@ -534,42 +653,48 @@ void arbitration::acceptclaim(uint64_t case_id, name assigned_arb, string claim_
 	auto arb_case = std::find(cf.arbitrators.begin(), cf.arbitrators.end(), assigned_arb);
 	check(arb_case != cf.arbitrators.end(), "Only the assigned arbitrator can accept a claim");
 
-	check(decision_class > UNDECIDED && decision_class <= MISC, "decision_class must be valid [2 - 15]");
 	check(cf.case_status < DECISION && cf.case_status > AWAITING_ARBS, "unable to dismiss claim while this case file is in this status");
 	
 	claims_table claims(get_self(), get_self().value);
 
-	vector<claim> new_unread_claims = cf.unread_claims;
+	unread_claims_table unread_claims(get_self(), case_id);
 
-	auto claim_it = get_claim_at(claim_hash, new_unread_claims);
-	check(claim_it != new_unread_claims.end(), "Claim Hash not found in casefile");
-	auto response_link = claim_it->response_link;
-	new_unread_claims.erase(claim_it);
 	uint64_t new_claim_id = claims.available_primary_key();
 	vector<uint64_t> new_accepted_claims = cf.accepted_claims;
-	new_accepted_claims.emplace_back(new_claim_id);
+	vector<uint8_t> decision_classes;
+
+	for (const auto& d : decisions)
+	{
+		check(d.decision_class > UNDECIDED && d.decision_class <= MISC, "decision_class must be valid [2 - 15]");
+		auto claim_cid = to_cid(d.claim_hash);
+		auto decision_cid = to_cid(d.decision_link);
+
+		auto claim_it = get_claim_at(claim_cid, unread_claims);
+		check(claim_it != unread_claims.end(), "Claim Hash not found in casefile");
+		auto response_link = claim_it->response_link;
+		unread_claims.erase(claim_it);
+		erase_claim_ref(claim_cid, case_id, false);
+
+		claims.emplace(get_self(), [&](auto &row) {
+			row.claim_id = new_claim_id;
+			row.claim_summary = claim_cid;
+			row.decision_link = decision_cid;
+			row.decision_class = d.decision_class;
+			row.response_link = response_link;
+		});
+		add_claim_ref(claim_cid, case_id, new_claim_id, true, get_self());
+
+		new_accepted_claims.emplace_back(new_claim_id);
+		decision_classes.emplace_back(d.decision_class);
+		emit_event(CLAIM_ACCEPTED, case_id, cf.case_status, assigned_arb, new_claim_id++);
+	}
 
 	casefiles.modify(cf, same_payer, [&](auto &row) {
-		row.unread_claims = new_unread_claims;
 		row.accepted_claims = new_accepted_claims;
 		row.last_edit = current_time_point().sec_since_epoch();
 	});
 
-	claims.emplace(get_self(), [&](auto &row) {
-		row.claim_id = new_claim_id;
-		row.claim_summary = claim_hash;
-		row.decision_link = decision_link;
-		row.decision_class = decision_class;
-		row.response_link = response_link;
-	});
-	
-	exec_claim exec(get_self(), { get_self(), "active"_n });
-	exec.send(new_claim_id, case_id, assigned_arb, claim_hash, decision_link, decision_class);
-}
-
-void arbitration::execclaim(uint64_t new_claim_id, uint64_t case_id, name assigned_arb, string claim_hash,
-				string decision_link, uint8_t decision_class) {
-	require_auth(get_self());
+	track_decisions(decision_classes);
 }
 
 void arbitration::setruling(uint64_t case_id, name assigned_arb, string case_ruling) {
@@ -580,11 +705,14 @@ void arbitration::setruling(uint64_t case_id, name assigned_arb, string case_rul
 
 	auto arb_it = std::find(cf.arbitrators.begin(), cf.arbitrators.end(), assigned_arb);
 	check(arb_it != cf.arbitrators.end(), "arbitrator is not assigned to this case_id");
-	validate_ipfs_url(case_ruling);
+	auto ruling_cid = to_cid(case_ruling);
 
 	casefiles.modify(cf, same_payer, [&](auto& row) {
-		row.case_ruling = case_ruling;
+		row.case_ruling = ruling_cid;
+		row.last_edit = current_time_point().sec_since_epoch();
 	});
+
+	emit_event(RULING_SET, case_id, cf.case_status, assigned_arb);
 }
 
 void arbitration::advancecase(uint64_t case_id, name assigned_arb)
@@ -596,35 +724,46 @@ void arbitration::advancecase(uint64_t case_id, name assigned_arb)
 	check(cf.case_status > AWAITING_ARBS, "case_status must be greater than AWAITING_ARBS");
 	check(cf.case_status < RESOLVED && cf.case_status != DISMISSED, "Case has already been resolved or dismissed");
 	if (cf.case_status + 1 == RESOLVED) {
-		check(cf.case_ruling != string(""), "Case Ruling must be set before advancing case to RESOLVED status");
+		check(!cf.case_ruling.empty(), "Case Ruling must be set before advancing case to RESOLVED status");
 	}
 
 	auto arb_it = std::find(cf.arbitrators.begin(), cf.arbitrators.end(), assigned_arb);
 	check(arb_it != cf.arbitrators.end(), "actor is not assigned to this case_id");
 
-	auto approval_it = std::find(cf.approvals.begin(), cf.approvals.end(), assigned_arb);
-	check(approval_it == cf.approvals.end(), "arbitrator has already approved advancing this case");
+	uint32_t approval_bit = 1u << std::distance(cf.arbitrators.begin(), arb_it);
+	check((cf.approvals & approval_bit) == 0, "arbitrator has already approved advancing this case");
 
 	auto case_status = cf.case_status;
-	auto approvals = cf.approvals;
+	uint32_t approvals = cf.approvals | approval_bit;
 
-	if (approvals.size() + 1 < cf.arbitrators.size()) {
-		approvals.emplace_back(assigned_arb);
-	} else if (cf.approvals.size() + 1 >= cf.arbitrators.size()) {
+	if (static_cast<size_t>(__builtin_popcount(approvals)) >= cf.arbitrators.size()) {
 		case_status++;
-		approvals.clear();
+		approvals = 0;
 	}
 
 	casefiles.modify(cf, same_payer, [&](auto &row) {
+		if (row.case_status != case_status) {
+			row.deadline = get_deadline(case_status);
+		}
 		row.case_status = case_status;
 		row.approvals = approvals;
+		row.last_edit = current_time_point().sec_since_epoch();
 	});
+
+	if (approvals == 0) {
+		track_case(case_status - 1, case_status, cf.filed_time);
+	}
+	emit_event(approvals == 0 ? CASE_ADVANCED : CASE_APPROVED, case_id, case_status, assigned_arb);
+
+	if (case_status == RESOLVED) {
+		close_assignments(cf);
+	}
 }
 
 void arbitration::dismisscase(uint64_t case_id, name assigned_arb, string ruling_link)
 {
 	require_auth(assigned_arb);
-	validate_ipfs_url(ruling_link);
+	auto ruling_cid = to_cid(ruling_link);
 
 	casefiles_table casefiles(get_self(), get_self().value);
 	const auto& cf = casefiles.get(case_id, "No case found with given case_id");
@@ -635,9 +774,15 @@ void arbitration::dismisscase(uint64_t case_id, name assigned_arb, string ruling
 
 	casefiles.modify(cf, same_payer, [&](auto &row) {
 		row.case_status = DISMISSED;
-		row.case_ruling = ruling_link;
+		row.case_ruling = ruling_cid;
 		row.last_edit = current_time_point().sec_since_epoch();
+		row.deadline = 0;
 	});
+
+	close_assignments(cf);
+
+	track_case(CASE_INVESTIGATION, DISMISSED, cf.filed_time);
+	emit_event(CASE_DISMISSED, case_id, DISMISSED, assigned_arb);
 }
 
 void arbitration::recuse(uint64_t case_id, string rationale, name assigned_arb)
@@ -657,12 +802,23 @@ void arbitration::recuse(uint64_t case_id, string rationale, name assigned_arb)
 
 	vector<name> new_arbs = cf.arbitrators;
 	auto arb_it = find(new_arbs.begin(), new_arbs.end(), assigned_arb);
+	auto panel_pos = std::distance(new_arbs.begin(), arb_it);
 	new_arbs.erase(arb_it);
 
 	casefiles.modify(cf, same_payer, [&](auto &row) {
 		row.arbitrators = new_arbs;
+		row.approvals = drop_approval(row.approvals, panel_pos);
 		row.last_edit = current_time_point().sec_since_epoch();
 	});
+
+	del_assignment(case_id, assigned_arb, false);
+
+	emit_event(ARB_RECUSED, case_id, cf.case_status, assigned_arb);
+}
+
+void arbitration::arbevent(uint8_t version, uint8_t event_type, uint64_t case_id, uint8_t case_status,
+		name actor, uint64_t ref_id) {
+	require_auth(get_self());
 }
 
 #pragma endregion Case_Progression
@@ -676,11 +832,18 @@ void arbitration::newarbstatus(uint8_t new_status, name arbitrator)
 	arbitrators_table arbitrators(_self, _self.value);
 	const auto& arb = arbitrators.get(arbitrator.value, "Arbitrator not found");
 
-	check(new_status >= 0 && new_status <= 2, "Supplied status code is invalid for this action");
+	//NOTE: arbitrators may only toggle availability, REMOVED and SEAT_EXPIRED are set by the contract
+	check(new_status == AVAILABLE || new_status == UNAVAILABLE, "Supplied status code is invalid for this action");
+	check(arb.arb_status == AVAILABLE || arb.arb_status == UNAVAILABLE, 
+		"arbitrator is already removed or their seat has expired");
+	check(current_time_point().sec_since_epoch() < arb.term_expiration, "arbitrator term expired");
 
 	arbitrators.modify(arb, same_payer, [&](auto &row) {
 		row.arb_status = new_status;
 	});
+
+	sync_arb_perms(arbitrator, new_status);
+	flush_arb_perms();
 }
 
 void arbitration::setlangcodes(name arbitrator, vector<uint8_t> lang_codes)
@@ -690,9 +853,10 @@ void arbitration::setlangcodes(name arbitrator, vector<uint8_t> lang_codes)
 	const auto& arb = arbitrators.get(arbitrator.value, "arbitrator not found");
 
 	check(current_time_point().sec_since_epoch() < arb.term_expiration, "arbitrator term expired");
+	auto langs = to_lang_mask(lang_codes);
 
 	arbitrators.modify(arb, same_payer, [&](auto& a) {
-		a.languages = lang_codes;
+		a.languages = langs;
 	});
 }
 
@@ -704,12 +868,116 @@ void arbitration::deletecase(uint64_t case_id)
 
 	const auto& cf = casefiles.get(case_id, "case file not found");
 	//check(cf.case_status >= RESOLVED, "case must either be RESOLVED or DISMISSED");
+	auto claim_ids = cf.accepted_claims;
+	auto case_status = cf.case_status;
+	for (const auto& a : cf.arbitrators) {
+		del_assignment(case_id, a, false);
+	}
 	casefiles.erase(cf);
 
-	auto claim_ids = cf.accepted_claims;
+	del_unread_claims(case_id);
 	
 	for(auto& id : claim_ids) {
-		del_claim(id);
+		del_claim(case_id, id);
+	}
+
+	track_case(case_status, NO_STATUS);
+	emit_event(CASE_DELETED, case_id, case_status, get_self());
+}
+
+void arbitration::archivecases(uint16_t max)
+{
+	check(max > 0, "max must be greater than 0");
+
+	casefiles_table casefiles(get_self(), get_self().value);
+	archives_table archives(get_self(), get_self().value);
+	auto by_status = casefiles.get_index<"bystatus"_n>();
+
+	//NOTE: RESOLVED and DISMISSED are the last two states, so closed cases sit at the end of the index
+	auto itr = by_status.lower_bound(RESOLVED);
+	check(itr != by_status.end(), "no closed cases to archive");
+
+	for (uint16_t i = 0; i < max && itr != by_status.end(); i++)
+	{
+		archives.emplace(get_self(), [&](auto &row) {
+			row.case_id = itr->case_id;
+			row.case_status = itr->case_status;
+			row.claimant = itr->claimant;
+			row.respondant = itr->respondant;
+			row.ruling_hash = itr->case_ruling.empty() ? checksum256() : to_doc_hash(itr->case_ruling);
+			row.filed_time = itr->filed_time;
+			row.closed_time = itr->last_edit;
+			row.accepted_claims = itr->accepted_claims;
+		});
+
+		emit_event(CASE_ARCHIVED, itr->case_id, itr->case_status, get_self());
+
+		del_unread_claims(itr->case_id);
+		itr = by_status.erase(itr);
+	}
+}
+
+void arbitration::sweepcases(uint16_t max)
+{
+	check(max > 0, "max must be greater than 0");
+
+	casefiles_table casefiles(get_self(), get_self().value);
+	auto by_deadline = casefiles.get_index<"bydeadline"_n>();
+	uint32_t now = current_time_point().sec_since_epoch();
+	uint16_t swept = 0;
+
+	//NOTE: rows leave the index range once swept, so each lookup starts from the oldest deadline left
+	for (uint8_t status = CASE_SETUP; status < RESOLVED && swept < max; status++)
+	{
+		uint128_t first = (static_cast<uint128_t>(status) << 64) | 1;
+		uint128_t last = (static_cast<uint128_t>(status) << 64) | now;
+
+		for (auto itr = by_deadline.lower_bound(first); itr != by_deadline.end() && itr->by_deadline() < last && swept < max;
+			 itr = by_deadline.lower_bound(first), swept++)
+		{
+			//NOTE: stale setups paid no fee, they are shredded so no archive row is billed to the contract
+			if (status == CASE_SETUP)
+			{
+				uint64_t case_id = itr->case_id;
+				del_unread_claims(case_id);
+				by_deadline.erase(itr);
+
+				track_case(CASE_SETUP, NO_STATUS);
+				emit_event(CASE_SHREDDED, case_id, CASE_SETUP, get_self());
+			}
+			else
+			{
+				by_deadline.modify(itr, same_payer, [&](auto &row) {
+					row.deadline = 0;
+				});
+
+				emit_event(CASE_OVERDUE, itr->case_id, status, get_self());
+			}
+		}
+	}
+
+	check(swept > 0, "no overdue cases to sweep");
+}
+
+void arbitration::cleanarbs(uint16_t max)
+{
+	check(max > 0, "max must be greater than 0");
+
+	arb_cleanups_table cleanups(get_self(), get_self().value);
+	check(cleanups.begin() != cleanups.end(), "no arbitrators queued for cleanup");
+
+	arbitrators_table arbitrators(get_self(), get_self().value);
+	uint16_t budget = max;
+
+	for (auto itr = cleanups.begin(); itr != cleanups.end() && budget > 0;)
+	{
+		//NOTE: an arbitrator re-elected before the cleanup finished keeps the cases assigned since
+		auto a = arbitrators.find(itr->arb.value);
+		if (a != arbitrators.end() && a->arb_status == REMOVED && !clean_arb_cases(itr->arb, budget)) {
+			break;
+		}
+
+		itr = cleanups.erase(itr);
 	}
 }
 
@@ -733,35 +1001,20 @@ void arbitration::deletecase(uint64_t case_id)
 			a.arb_status = REMOVED;
 		});
 
-		auto perms = get_arb_permissions();
-		set_permissions(perms);
+		sync_arb_perms(arb, REMOVED);
+		flush_arb_perms();
 
 		if(remove_from_cases) {
-			casefiles_table casefiles(get_self(), get_self().value);
-
-			for(const auto &id: to_dismiss.open_case_ids) {
-				auto cf_it = casefiles.find(id);
-
-				if (cf_it != casefiles.end()) {
-					auto case_arbs = cf_it->arbitrators;
-					auto arb_it = find(case_arbs.begin(), case_arbs.end(), to_dismiss.arb);
-
-					if (arb_it != case_arbs.end() && cf_it->case_status < RESOLVED) {
-						case_arbs.erase(arb_it);
-						casefiles.modify(cf_it, same_payer, [&](auto &row) {
-							row.arbitrators = case_arbs;
-						});
-					}
+			uint16_t budget = MAX_CLEANUP_BATCH;
+			if (!clean_arb_cases(arb, budget)) {
+				arb_cleanups_table cleanups(get_self(), get_self().value);
+				if (cleanups.find(arb.value) == cleanups.end()) {
+					cleanups.emplace(get_self(), [&](auto& row) {
+						row.arb = arb;
+						row.queued_time = current_time_point().sec_since_epoch();
+					});
 				}
 			}
-
-			auto open_ids = to_dismiss.open_case_ids;
-			open_ids.clear();
-
-			arbitrators.modify(to_dismiss, same_payer, [&](auto& a) {
-				a.arb_status = REMOVED;
-				a.open_case_ids = open_ids;
-			});
 		}
 	}
 #pragma endregion BP_Multisig_Actions
@@ -776,16 +1029,141 @@ bool arbitration::is_arb(name account)
 	return arbitrators.find(account.value) != arbitrators.end();
 }
 
-vector<claim>::iterator arbitration::get_claim_at(string hash, vector<claim>& claims)
+arbitration::unread_claims_table::const_iterator arbitration::get_claim_at(const ipfs_cid& hash, unread_claims_table& claims)
+{
+	claim_refs_table claim_refs(get_self(), get_self().value);
+	auto ref = find_claim_ref(claim_refs, hash, claims.get_scope(), false);
+	return ref == claim_refs.end() ? claims.end() : claims.find(ref->claim_id);
+}
+
+//NOTE: to_cid only accepts sha2-256 multihashes, so the last 32 bytes of any cid are the document digest
+checksum256 arbitration::to_doc_hash(const ipfs_cid& cid)
+{
+	check(cid.size() >= 32, "invalid ipfs cid");
+	std::array<uint8_t, 32> digest;
+	std::copy(cid.end() - 32, cid.end(), digest.begin());
+	return checksum256(digest);
+}
+
+arbitration::claim_refs_table::const_iterator arbitration::find_claim_ref(claim_refs_table& claim_refs,
+		const ipfs_cid& cid, uint64_t case_id, bool accepted)
+{
+	auto by_case_hash = claim_refs.get_index<"bycasehash"_n>();
+	auto itr = by_case_hash.find(claim_ref::case_hash(to_doc_hash(cid), case_id, accepted));
+	return itr == by_case_hash.end() ? claim_refs.end() : claim_refs.find(itr->ref_id);
+}
+
+void arbitration::add_claim_ref(const ipfs_cid& cid, uint64_t case_id, uint64_t claim_id, bool accepted, name ram_payer)
 {
-	return std::find_if(claims.begin(), claims.end(), [&](auto &claim) {
-		return claim.claim_summary == hash;
+	claim_refs_table claim_refs(get_self(), get_self().value);
+	claim_refs.emplace(ram_payer, [&](auto &row) {
+		row.ref_id = claim_refs.available_primary_key();
+		row.doc_hash = to_doc_hash(cid);
+		row.case_id = case_id;
+		row.claim_id = claim_id;
+		row.accepted = accepted;
 	});
 }
 
-void arbitration::validate_ipfs_url(string ipfs_url)
+void arbitration::erase_claim_ref(const ipfs_cid& cid, uint64_t case_id, bool accepted)
+{
+	claim_refs_table claim_refs(get_self(), get_self().value);
+	auto ref = find_claim_ref(claim_refs, cid, case_id, accepted);
+	if (ref != claim_refs.end()) {
+		claim_refs.erase(ref);
+	}
+}
+
+//NOTE: accepts base58btc CIDv0 ("Qm...", 46 chars) and base32 CIDv1 ("b...", 59 chars),
+// both must carry a sha2-256 multihash. Claims are matched on that digest, see to_doc_hash,
+// so the v0 and v1 forms of a document are the same claim.
+arbitration::ipfs_cid arbitration::to_cid(string ipfs_url)
 {
-	check(ipfs_url.length() == 46 || ipfs_url.length() == 49, "invalid ipfs string, valid schema: <hash>");
+	const char* error_msg = "invalid ipfs string, valid schema: <hash>";
+	const string base58 = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+	const string base32 = "abcdefghijklmnopqrstuvwxyz234567";
+	ipfs_cid cid;
+
+	if (ipfs_url.length() == 46) {
+		cid.resize(34);
+		for (const char c : ipfs_url) {
+			auto digit = base58.find(c);
+			check(digit != string::npos, error_msg);
+
+			uint32_t carry = digit;
+			for (auto it = cid.rbegin(); it != cid.rend(); ++it) {
+				carry += uint32_t(uint8_t(*it)) * 58;
+				*it = char(carry & 0xff);
+				carry >>= 8;
+			}
+			check(carry == 0, error_msg);
+		}
+		check(cid[0] == 0x12 && cid[1] == 0x20, error_msg);
+	} else if (ipfs_url.length() == 59 && ipfs_url[0] == 'b') {
+		cid.reserve(36);
+		uint32_t buffer = 0;
+		uint8_t bits = 0;
+		for (auto it = ipfs_url.begin() + 1; it != ipfs_url.end(); ++it) {
+			auto digit = base32.find(*it);
+			check(digit != string::npos, error_msg);
+
+			buffer = (buffer << 5) | digit;
+			bits += 5;
+			if (bits >= 8) {
+				bits -= 8;
+				cid.push_back(char((buffer >> bits) & 0xff));
+			}
+		}
+		//NOTE: the 2 bits left over after the last byte must be zero, so every cid has one spelling
+		check((buffer & ((1u << bits) - 1)) == 0, error_msg);
+		check(cid.size() == 36 && cid[0] == 0x01 && uint8_t(cid[1]) < 0x80 && cid[2] == 0x12 && cid[3] == 0x20, error_msg);
+	} else {
+		check(false, error_msg);
+	}
+
+	return cid;
+}
+
+string arbitration::to_ipfs_url(const ipfs_cid& cid)
+{
+	if (cid.size() == 36) {
+		const string base32 = "abcdefghijklmnopqrstuvwxyz234567";
+		string ipfs_url = "b";
+		uint32_t buffer = 0;
+		uint8_t bits = 0;
+		for (const char byte : cid) {
+			buffer = (buffer << 8) | uint8_t(byte);
+			bits += 8;
+			while (bits >= 5) {
+				bits -= 5;
+				ipfs_url.push_back(base32[(buffer >> bits) & 0x1f]);
+			}
+		}
+		if (bits > 0) {
+			ipfs_url.push_back(base32[(buffer << (5 - bits)) & 0x1f]);
+		}
+		return ipfs_url;
+	}
+
+	const string base58 = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+	vector<uint8_t> digits;
+	for (const char byte : cid) {
+		uint32_t carry = uint8_t(byte);
+		for (auto& d : digits) {
+			carry += uint32_t(d) << 8;
+			d = carry % 58;
+			carry /= 58;
+		}
+		for (; carry > 0; carry /= 58) {
+			digits.push_back(carry % 58);
+		}
+	}
+
+	string ipfs_url;
+	for (auto it = digits.rbegin(); it != digits.rend(); ++it) {
+		ipfs_url.push_back(base58[*it]);
+	}
+	return ipfs_url;
 }
 
 void arbitration::assert_string(string to_check, string error_msg)
@@ -793,6 +1171,209 @@ void arbitration::assert_string(string to_check, string error_msg)
 	check(to_check.length() > 0 && to_check.length() < 255, error_msg.c_str());
 }
 
+uint64_t arbitration::create_case(name claimant, const vector<string>& claim_links, uint16_t langs, name respondant,
+		name ram_payer)
+{
+	check(!claim_links.empty(), "claim_links cannot be empty");
+	check(claim_links.size() <= MAX_UNREAD_CLAIMS, "case file has reached maximum number of claims");
+	if (respondant != name(0)) {
+		check(is_account(respondant), "respondant must be an account");
+	}
+
+	casefiles_table casefiles(get_self(), get_self().value);
+	uint64_t new_case_id = casefiles.available_primary_key();
+
+	casefiles.emplace(ram_payer, [&](auto &row) {
+		row.case_id = new_case_id;
+		row.case_status = CASE_SETUP;
+		row.claimant = claimant;
+		row.respondant = respondant;
+		row.arbitrators = {};
+		row.approvals = 0;
+		row.required_langs = langs;
+		row.accepted_claims = {};
+		row.case_ruling = {};
+		row.last_edit = current_time_point().sec_since_epoch();
+		row.filed_time = row.last_edit;
+		row.deadline = get_deadline(CASE_SETUP);
+	});
+
+	track_case(NO_STATUS, CASE_SETUP);
+	emit_event(CASE_FILED, new_case_id, CASE_SETUP, claimant, 0);
+
+	unread_claims_table unread_claims(get_self(), new_case_id);
+	for (uint64_t claim_id = 0; claim_id < claim_links.size(); claim_id++)
+	{
+		auto claim_cid = to_cid(claim_links[claim_id]);
+		check(get_claim_at(claim_cid, unread_claims) == unread_claims.end(), "ipfs hash exists in another claim");
+
+		unread_claims.emplace(ram_payer, [&](auto &row) {
+			row.claim_id = claim_id;
+			row.claim_summary = claim_cid;
+		});
+		add_claim_ref(claim_cid, new_case_id, claim_id, false, ram_payer);
+
+		if (claim_id > 0) {
+			emit_event(CLAIM_ADDED, new_case_id, CASE_SETUP, claimant, claim_id);
+		}
+	}
+
+	return new_case_id;
+}
+
+//NOTE: charges the filing fee and moves a checked CASE_SETUP case to AWAITING_ARBS
+void arbitration::ready_case(casefiles_table& casefiles, const casefile& cf)
+{
+	auto fee = asset(get_config().fee_structure[0], native_sym);
+	sub_balance(cf.claimant, fee);
+	track_fee(fee);
+
+	//NOTE: the panel is picked first so readying and auto assignment share one modify
+	vector<name> selected;
+	if (get_config().arbs_per_case > 0) {
+		selected = select_arbitrators(cf, get_config().arbs_per_case);
+	}
+	uint8_t case_status = selected.empty() ? AWAITING_ARBS : CASE_INVESTIGATION;
+
+	casefiles.modify(cf, get_self(), [&](auto &row) {
+		row.case_status = case_status;
+		row.arbitrators.insert(row.arbitrators.end(), selected.begin(), selected.end());
+		row.last_edit = current_time_point().sec_since_epoch();
+		row.deadline = get_deadline(case_status);
+	});
+
+	track_case(CASE_SETUP, case_status);
+	emit_event(CASE_READIED, cf.case_id, AWAITING_ARBS, cf.claimant);
+	seat_arbitrators(cf, selected);
+}
+
+//NOTE: memo format "filecase|<respondant>|<lang codes>|<claim links>", lists are comma separated.
+// RAM is paid by the contract since notifications can't bill the sender.
+void arbitration::file_from_memo(name claimant, asset quantity, const string& memo)
+{
+	auto parts = split(memo, '|');
+	check(parts.size() == 4, "filecase memo must be filecase|<respondant>|<lang codes>|<claim links>");
+	auto claim_links = split(parts[3], ',');
+
+	//NOTE: a notification can't bill the sender, so the deposit pays for the rows the contract stores
+	auto deposit = asset(MEMO_CLAIM_DEPOSIT * int64_t(claim_links.size()), native_sym);
+	check(quantity >= deposit + asset(get_config().fee_structure[0], native_sym),
+		"transfer must cover the filing fee and claim deposit");
+
+	vector<uint8_t> lang_codes;
+	for (const auto& code : split(parts[2], ',')) {
+		check(!code.empty() && code.size() <= 2, "invalid language code");
+		uint8_t lang = 0;
+		for (char c : code) {
+			check(c >= '0' && c <= '9', "invalid language code");
+			lang = lang * 10 + (c - '0');
+		}
+		lang_codes.emplace_back(lang);
+	}
+
+	auto case_id = create_case(claimant, claim_links, to_lang_mask(lang_codes),
+		parts[1].empty() ? name(0) : name(parts[1]), get_self());
+	sub_balance(claimant, deposit); //NOTE: the deposit pays for RAM, it isn't counted as a fee
+
+	casefiles_table casefiles(get_self(), get_self().value);
+	ready_case(casefiles, casefiles.get(case_id));
+}
+
+vector<string> arbitration::split(const string& str, char delim)
+{
+	vector<string> parts;
+	if (str.empty()) {
+		return parts;
+	}
+
+	size_t start = 0;
+	for (size_t pos = str.find(delim); pos != string::npos; pos = str.find(delim, start)) {
+		parts.emplace_back(str.substr(start, pos - start));
+		start = pos + 1;
+	}
+	parts.emplace_back(str.substr(start));
+	return parts;
+}
+
+uint32_t arbitration::get_deadline(uint8_t case_status)
+{
+	const auto& deadlines = get_config().case_deadlines;
+	if (case_status >= deadlines.size() || deadlines[case_status] == 0) {
+		return 0;
+	}
+	return current_time_point().sec_since_epoch() + deadlines[case_status];
+}
+
+void arbitration::track_case(uint8_t from_status, uint8_t to_status, uint32_t filed_time)
+{
+	auto& s = get_stats();
+	s.cases_by_status.resize(DISMISSED + 1);
+
+	if (from_status != NO_STATUS && s.cases_by_status[from_status] > 0) {
+		s.cases_by_status[from_status]--;
+	}
+
+	if (to_status != NO_STATUS) {
+		s.cases_by_status[to_status]++;
+
+		if (to_status >= RESOLVED && from_status < RESOLVED) {
+			s.closed_cases++;
+			s.total_resolution_time += current_time_point().sec_since_epoch() - filed_time;
+		}
+	}
+}
+
+void arbitration::track_decisions(const vector<uint8_t>& decision_classes)
+{
+	auto& s = get_stats();
+	s.decisions_by_class.resize(MISC + 1);
+	for (auto decision_class : decision_classes) {
+		s.decisions_by_class[decision_class]++;
+	}
+}
+
+void arbitration::track_fee(asset fee)
+{
+	get_stats().fees_collected += fee;
+}
+
+void arbitration::emit_event(uint8_t event_type, uint64_t case_id, uint8_t case_status, name actor, uint64_t ref_id)
+{
+	arb_event event(get_self(), {get_self(), "active"_n});
+	event.send(ARB_EVENT_VERSION, event_type, case_id, case_status, actor, ref_id);
+}
+
+uint16_t arbitration::to_lang_mask(const vector<uint8_t>& lang_codes)
+{
+	uint16_t mask = 0;
+	for (auto code : lang_codes) {
+		check(code <= SWED, "invalid language code");
+		mask |= uint16_t(1) << code;
+	}
+	return mask;
+}
+
+arbitration::config& arbitration::get_config()
+{
+	if (!_config)
+	{
+		_config_existed = configs.exists();
+		_config = _config_existed ? configs.get() : get_default_config();
+		_config_snapshot = pack(*_config);
+	}
+	return *_config;
+}
+
+arbitration::arb_stats& arbitration::get_stats()
+{
+	if (!_stats)
+	{
+		stats_singleton stats(get_self(), get_self().value);
+		_stats = stats.get_or_default();
+	}
+	return *_stats;
+}
+
 arbitration::config arbitration::get_default_config()
 {
 	vector<int64_t> fees{2000000};
@@ -806,15 +1387,36 @@ arbitration::config arbitration::get_default_config()
 		current_time_point().sec_since_epoch(),
 		uint64_t(0), 		// current_ballot_id
 		bool(0),	 		// auto_start_election
+		uint8_t(0),			// arbs_per_case
+		uint8_t(PHASE_IDLE),	// election_phase
+		uint64_t(0),		// election_cursor
+		int64_t(0),			// election_cutoff
+		uint16_t(0),		// occupied_seats
+		vector<uint32_t>{},	// case_deadlines
 	};
 
 	return c;
 }
 
+//NOTE: the candidate after the last seat sets the cutoff, so candidates tied with it are all left out
+int64_t arbitration::get_election_cutoff(const leaderboard& board)
+{
+	auto board_candidates = get_tallied_candidates(board);
+	if (board_candidates.size() <= board.available_seats)
+		return -1;
+
+	auto first_cand_out = board_candidates.begin() + board.available_seats;
+	nth_element(board_candidates.begin(), first_cand_out, board_candidates.end(), [](const auto &c1, const auto &c2) {
+		return c1.votes > c2.votes;
+	});
+
+	return first_cand_out->votes.amount;
+}
+
 void arbitration::start_new_election(uint8_t available_seats)
 {
-	uint32_t begin_time = current_time_point().sec_since_epoch() + _config.election_start;
-	uint32_t end_time = begin_time + _config.election_duration;
+	uint32_t begin_time = current_time_point().sec_since_epoch() + get_config().election_start;
+	uint32_t end_time = begin_time + get_config().election_duration;
 
 	action(permission_level{get_self(), "active"_n}, "eosio.trail"_n, "regballot"_n,
 		   make_tuple(get_self(),		 	// publisher
@@ -828,7 +1430,7 @@ void arbitration::start_new_election(uint8_t available_seats)
 
 	action(permission_level{get_self(), "active"_n}, "eosio.trail"_n, "setseats"_n,
 		   make_tuple(get_self(),
-					  _config.current_ballot_id,
+					  get_config().current_ballot_id,
 					  available_seats))
 		.send();
 
@@ -837,73 +1439,116 @@ void arbitration::start_new_election(uint8_t available_seats)
 
 bool arbitration::has_available_seats(arbitrators_table &arbitrators, uint8_t &available_seats)
 {
-	uint8_t occupied_seats = 0;
+	auto by_expiration = arbitrators.get_index<"byexpiration"_n>();
+	uint32_t now = current_time_point().sec_since_epoch();
 
-	for (auto &arb : arbitrators)
+	//NOTE: expired seats move to the back of the index, so only seats that just expired are visited
+	for (auto itr = by_expiration.begin(); itr != by_expiration.end() && itr->arb_status != uint16_t(SEAT_EXPIRED)
+			&& now > itr->term_expiration; itr = by_expiration.begin())
 	{
-		// check if arb seat is expired
-		if (current_time_point().sec_since_epoch() > arb.term_expiration && arb.arb_status != uint16_t(SEAT_EXPIRED))
-		{
-			arbitrators.modify(arb, same_payer, [&](auto &a) {
-				a.arb_status = uint16_t(SEAT_EXPIRED);
-			});
-		}
+		by_expiration.modify(itr, same_payer, [&](auto &a) {
+			a.arb_status = uint16_t(SEAT_EXPIRED);
+		});
+		sync_arb_perms(itr->arb, SEAT_EXPIRED);
 
-		if (arb.arb_status != uint16_t(SEAT_EXPIRED))
-			occupied_seats++;
+		if (get_config().occupied_seats > 0)
+			get_config().occupied_seats--;
 	}
-	available_seats = uint8_t(_config.max_elected_arbs - occupied_seats);
+
+	//NOTE: expired seats lose eosio.arb@major here, the election that follows may run after PHASE_PERMS
+	flush_arb_perms();
+
+	auto max_seats = get_config().max_elected_arbs;
+	auto occupied_seats = get_config().occupied_seats;
+	available_seats = occupied_seats < max_seats ? uint8_t(max_seats - occupied_seats) : uint8_t(0);
 
 	return available_seats > 0;
 }
 
-vector<arbitration::permission_level_weight> arbitration::get_arb_permissions() {
-	arbitrators_table arbitrators(get_self(), get_self().value);
-	vector<permission_level_weight> perms;
-	for(const auto &a: arbitrators) {
-		if (a.arb_status != SEAT_EXPIRED || a.arb_status != REMOVED)
-		{
-			perms.emplace_back(permission_level_weight{permission_level{a.arb, "active"_n}, 1});
-		}
+arbitration::arb_perms arbitration::get_arb_perms() {
+	arb_perms_singleton arbperms(get_self(), get_self().value);
+	return arbperms.get_or_default();
+}
+
+void arbitration::sync_arb_perms(name arb, uint8_t arb_status) {
+	auto perms = get_arb_perms();
+	auto it = std::lower_bound(perms.members.begin(), perms.members.end(), arb);
+	bool listed = it != perms.members.end() && *it == arb;
+	bool seated = arb_status == AVAILABLE || arb_status == UNAVAILABLE;
+
+	if (seated == listed) {
+		return;
+	}
+
+	if (seated) {
+		perms.members.insert(it, arb);
+	} else {
+		perms.members.erase(it);
+	}
+	perms.dirty = true;
+
+	arb_perms_singleton arbperms(get_self(), get_self().value);
+	arbperms.set(perms, get_self());
+}
+
+void arbitration::flush_arb_perms() {
+	auto perms = get_arb_perms();
+	if (!perms.dirty) {
+		return;
+	}
+
+	vector<permission_level_weight> weights;
+	for(const auto &member: perms.members) {
+		weights.emplace_back(permission_level_weight{permission_level{member, "active"_n}, 1});
 	}
-	return perms;
+	set_permissions(weights);
+
+	perms.dirty = false;
+	arb_perms_singleton arbperms(get_self(), get_self().value);
+	arbperms.set(perms, get_self());
 }
 
 void arbitration::set_permissions(vector<permission_level_weight> &perms) {
+	//NOTE: an authority needs at least one entry, with no seated arbitrators major falls back to eosio.arb@active
+	if (perms.empty())
+		perms.emplace_back(permission_level_weight{permission_level{get_self(), "active"_n}, 1});
+
 	//review update auth permissions and weights.
-	if (perms.size() > 0)
-	{
-		sort(perms.begin(), perms.end(), [](const auto &first, const auto &second) 
-			{ return first.permission.actor.value < second.permission.actor.value; });
-
-		uint32_t weight = perms.size() > 3 ? (((2 * perms.size()) / uint32_t(3)) + 1) : 1;
-
-		action(permission_level{get_self(), "owner"_n}, "eosio"_n, "updateauth"_n,
-				std::make_tuple(
-					get_self(),
-					"major"_n,
-					"owner"_n,
-					authority{
-						weight,
-						std::vector<key_weight>{},
-						perms,
-						std::vector<wait_weight>{}}))
-			.send();
-	}
+	sort(perms.begin(), perms.end(), [](const auto &first, const auto &second) 
+		{ return first.permission.actor.value < second.permission.actor.value; });
+
+	uint32_t weight = perms.size() > 3 ? (((2 * perms.size()) / uint32_t(3)) + 1) : 1;
+
+	action(permission_level{get_self(), "owner"_n}, "eosio"_n, "updateauth"_n,
+			std::make_tuple(
+				get_self(),
+				"major"_n,
+				"owner"_n,
+				authority{
+					weight,
+					std::vector<key_weight>{},
+					perms,
+					std::vector<wait_weight>{}}))
+		.send();
 }
 
-void arbitration::add_arbitrator(arbitrators_table &arbitrators, name arb_name, string credential_link)
+void arbitration::add_arbitrator(arbitrators_table &arbitrators, name arb_name, ipfs_cid credential_link)
 {
 	auto arb = arbitrators.find(arb_name.value);
+	if (arb == arbitrators.end() || arb->arb_status == SEAT_EXPIRED)
+	{
+		get_config().occupied_seats++;
+	}
+
 	if (arb == arbitrators.end())
 	{
 		arbitrators.emplace(_self, [&](auto &a) {
 			a.arb = arb_name;
 			a.arb_status = uint16_t(UNAVAILABLE);
 			a.elected_time = current_time_point().sec_since_epoch();
-			a.term_expiration = current_time_point().sec_since_epoch() + _config.arb_term_length;
-			a.open_case_ids = vector<uint64_t>();
-			a.closed_case_ids = vector<uint64_t>();
+			a.term_expiration = current_time_point().sec_since_epoch() + get_config().arb_term_length;
+			a.open_cases = 0;
+			a.closed_cases = 0;
 			a.credentials_link = credential_link;
 		});
 	}
@@ -912,18 +1557,234 @@ void arbitration::add_arbitrator(arbitrators_table &arbitrators, name arb_name,
 		arbitrators.modify(arb, same_payer, [&](auto &a) {
 			a.arb_status = uint16_t(UNAVAILABLE);
 			a.elected_time = current_time_point().sec_since_epoch();
-			a.term_expiration = current_time_point().sec_since_epoch() + _config.arb_term_length;
+			a.term_expiration = current_time_point().sec_since_epoch() + get_config().arb_term_length;
 			a.credentials_link = credential_link;
 		});
 	}
+
+	sync_arb_perms(arb_name, UNAVAILABLE);
 }
 
-void arbitration::del_claim(uint64_t claim_id) {
+void arbitration::del_claim(uint64_t case_id, uint64_t claim_id) {
 	claims_table claims(get_self(), get_self().value);
 	const auto& claim = claims.get(claim_id, "claim not found");
+	erase_claim_ref(claim.claim_summary, case_id, true);
 	claims.erase(claim);
 }
 
+void arbitration::del_unread_claims(uint64_t case_id) {
+	unread_claims_table unread_claims(get_self(), case_id);
+	auto claim_it = unread_claims.begin();
+	while(claim_it != unread_claims.end()) {
+		erase_claim_ref(claim_it->claim_summary, case_id, false);
+		claim_it = unread_claims.erase(claim_it);
+	}
+}
+
+void arbitration::add_assignment(uint64_t case_id, name arb) {
+	assignments_table assignments(get_self(), get_self().value);
+	assignments.emplace(get_self(), [&](auto &row) {
+		row.assignment_id = assignments.available_primary_key();
+		row.arb = arb;
+		row.case_id = case_id;
+		row.assigned_time = current_time_point().sec_since_epoch();
+	});
+
+	arbitrators_table arbitrators(get_self(), get_self().value);
+	const auto& a = arbitrators.get(arb.value, "arbitrator not found");
+	arbitrators.modify(a, same_payer, [&](auto &row) {
+		row.open_cases++;
+	});
+}
+
+//NOTE: closed is true when the case reached a ruling, false on recusal or removal.
+void arbitration::del_assignment(uint64_t case_id, name arb, bool closed) {
+	assignments_table assignments(get_self(), get_self().value);
+	auto by_case = assignments.get_index<"bycasearb"_n>();
+	auto itr = by_case.find((static_cast<uint128_t>(case_id) << 64) | arb.value);
+	if (itr == by_case.end()) {
+		return;
+	}
+	by_case.erase(itr);
+
+	arbitrators_table arbitrators(get_self(), get_self().value);
+	auto a = arbitrators.find(arb.value);
+	if (a != arbitrators.end()) {
+		arbitrators.modify(a, same_payer, [&](auto &row) {
+			if (row.open_cases > 0) row.open_cases--;
+			if (closed) row.closed_cases++;
+		});
+	}
+}
+
+void arbitration::close_assignments(const casefile& cf) {
+	for (const auto& a : cf.arbitrators) {
+		del_assignment(cf.case_id, a, true);
+	}
+}
+
+//NOTE: removes arb from its open cases, one budget unit per case.
+// Returns true once arb has no assignments left.
+bool arbitration::clean_arb_cases(name arb, uint16_t& budget) {
+	casefiles_table casefiles(get_self(), get_self().value);
+	assignments_table assignments(get_self(), get_self().value);
+	auto by_arb = assignments.get_index<"byarbcase"_n>();
+	uint32_t removed = 0;
+
+	auto itr = by_arb.lower_bound(static_cast<uint128_t>(arb.value) << 64);
+	for (; itr != by_arb.end() && itr->arb == arb && budget > 0; budget--) {
+		auto cf_it = casefiles.find(itr->case_id);
+
+		if (cf_it != casefiles.end()) {
+			auto case_arbs = cf_it->arbitrators;
+			auto arb_it = find(case_arbs.begin(), case_arbs.end(), arb);
+
+			if (arb_it != case_arbs.end() && cf_it->case_status < RESOLVED) {
+				auto panel_pos = std::distance(case_arbs.begin(), arb_it);
+				case_arbs.erase(arb_it);
+				casefiles.modify(cf_it, same_payer, [&](auto &row) {
+					row.arbitrators = case_arbs;
+					row.approvals = drop_approval(row.approvals, panel_pos);
+				});
+
+				emit_event(ARB_REMOVED, cf_it->case_id, cf_it->case_status, arb);
+			}
+		}
+
+		itr = by_arb.erase(itr);
+		removed++;
+	}
+
+	if (removed > 0) {
+		arbitrators_table arbitrators(get_self(), get_self().value);
+		const auto& a = arbitrators.get(arb.value, "arbitrator not found");
+		arbitrators.modify(a, same_payer, [&](auto &row) {
+			row.open_cases = row.open_cases > removed ? row.open_cases - removed : 0;
+		});
+	}
+
+	return itr == by_arb.end() || itr->arb != arb;
+}
+
+//NOTE: removes the approval bit of the arbitrator at panel_pos, later seats shift down one bit
+// like the arbitrators vector does.
+uint32_t arbitration::drop_approval(uint32_t approvals, size_t panel_pos) {
+	//NOTE: shifted as 64 bits, panel_pos + 1 reaches 32 on a full panel
+	uint64_t bits = approvals;
+	uint64_t low_mask = (uint64_t(1) << panel_pos) - 1;
+	return uint32_t((bits & low_mask) | ((bits >> (panel_pos + 1)) << panel_pos));
+}
+
+//NOTE: walks the bylangs index over AVAILABLE arbitrators whose languages are a superset of the
+// case languages, jumping over the other language sets. Each language set is ordered by load, so only
+// its first num_arbs usable rows are candidates. Reads at most MAX_ASSIGN_SCAN rows.
+vector<name> arbitration::select_arbitrators(const casefile& cf, uint8_t num_arbs)
+{
+	arbitrators_table arbitrators(get_self(), get_self().value);
+	auto by_langs = arbitrators.get_index<"bylangs"_n>();
+	auto now = current_time_point().sec_since_epoch();
+	uint32_t required = cf.required_langs;
+
+	auto lang_key = [](uint32_t langs) {
+		return (static_cast<uint64_t>(AVAILABLE) << 48) | (static_cast<uint64_t>(langs) << 32);
+	};
+
+	//NOTE: smallest language set above langs that contains every required language
+	auto next_superset = [&](uint32_t langs) {
+		uint32_t next = langs + 1;
+		uint32_t missing = required & ~next;
+		if (missing) {
+			uint8_t bit = 31 - __builtin_clz(missing);
+			next = (((next >> bit) | 1) << bit) | required;
+		}
+		return next;
+	};
+
+	vector<std::pair<uint32_t, name>> candidates;
+	uint8_t scanned = 0;
+	auto itr = by_langs.lower_bound(lang_key(required));
+
+	while (itr != by_langs.end() && itr->arb_status == AVAILABLE && scanned < MAX_ASSIGN_SCAN)
+	{
+		uint32_t langs = itr->languages;
+
+		if ((langs & required) == required)
+		{
+			uint8_t taken = 0;
+			for (; itr != by_langs.end() && itr->arb_status == AVAILABLE && itr->languages == langs
+					&& taken < num_arbs && scanned < MAX_ASSIGN_SCAN; ++itr, ++scanned)
+			{
+				if (itr->term_expiration <= now ||
+					std::find(cf.arbitrators.begin(), cf.arbitrators.end(), itr->arb) != cf.arbitrators.end()) {
+					continue;
+				}
+
+				candidates.emplace_back(itr->open_cases, itr->arb);
+				taken++;
+			}
+		}
+		else
+		{
+			scanned++;
+		}
+
+		auto next = next_superset(langs);
+		if (next > UINT16_MAX) {
+			break;
+		}
+		itr = by_langs.lower_bound(lang_key(next));
+	}
+
+	std::stable_sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+		return a.first < b.first;
+	});
+
+	vector<name> selected;
+	for (size_t i = 0; i < candidates.size() && selected.size() < num_arbs; i++) {
+		selected.emplace_back(candidates[i].second);
+	}
+
+	return selected;
+}
+
+uint8_t arbitration::assign_arbitrators(casefiles_table& casefiles, const casefile& cf, uint8_t num_arbs)
+{
+	check(cf.arbitrators.size() + num_arbs <= MAX_PANEL_SIZE, "case panel is full");
+
+	auto selected = select_arbitrators(cf, num_arbs);
+	if (selected.empty()) {
+		return 0;
+	}
+
+	vector<name> new_arbs = cf.arbitrators;
+	new_arbs.insert(new_arbs.end(), selected.begin(), selected.end());
+	auto old_status = cf.case_status;
+
+	casefiles.modify(cf, same_payer, [&](auto &row) {
+		row.arbitrators = new_arbs;
+		if (row.case_status == AWAITING_ARBS) {
+			row.case_status = CASE_INVESTIGATION;
+			row.deadline = get_deadline(CASE_INVESTIGATION);
+		}
+		row.last_edit = current_time_point().sec_since_epoch();
+	});
+
+	if (old_status != cf.case_status) {
+		track_case(old_status, cf.case_status);
+	}
+
+	seat_arbitrators(cf, selected);
+	return selected.size();
+}
+
+void arbitration::seat_arbitrators(const casefile& cf, const vector<name>& arbs)
+{
+	for (const auto& arb : arbs) {
+		add_assignment(cf.case_id, arb);
+		emit_event(ARB_ASSIGNED, cf.case_id, cf.case_status, arb);
+	}
+}
+
 void arbitration::transfer_handler(name from, name to, asset quantity, string memo)
 {
 	require_auth(from);
@@ -941,6 +1802,11 @@ void arbitration::transfer_handler(name from, name to, asset quantity, string me
 
 	add_balance(from, quantity, get_self());
 
+	if (memo.rfind("filecase|", 0) == 0) {
+		file_from_memo(from, quantity, memo);
+		return;
+	}
+
 	print("\nDeposit Complete");
 }
 
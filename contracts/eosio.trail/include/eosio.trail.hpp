@@ -97,6 +97,9 @@ public:
 
     [[eosio::action]] void castvote(name voter, uint64_t ballot_id, uint16_t direction);
 
+    //NOTE: leaderboards only, votes for every candidate in directions in one action
+    [[eosio::action]] void castvotes(name voter, uint64_t ballot_id, vector<uint16_t> directions);
+
     [[eosio::action]] void deloldvotes(name voter, uint16_t num_to_delete);
 
     #pragma endregion Voting_Actions
@@ -131,6 +134,9 @@ public:
 
     [[eosio::action]] void addcandidate(name publisher, uint64_t ballot_id, name new_candidate, string info_link);
 
+    //NOTE: appends a page of candidates in one write, unlike setallcands it keeps the existing ones
+    [[eosio::action]] void addcands(name publisher, uint64_t ballot_id, vector<candidate> new_candidates);
+
     [[eosio::action]] void setallcands(name publisher, uint64_t ballot_id, vector<candidate> new_candidates);
 
     [[eosio::action]] void setallstats(name publisher, uint64_t ballot_id, vector<uint8_t> new_cand_statuses);
@@ -169,9 +175,16 @@ public:
     
     bool delete_leaderboard(uint64_t board_id, name publisher);
 
-    bool vote_for_leaderboard(name voter, uint64_t ballot_id, uint64_t board_id, uint16_t direction);
+    bool vote_for_leaderboard(name voter, uint64_t ballot_id, uint64_t board_id, const vector<uint16_t>& directions);
+
+    bool close_leaderboard(uint64_t ballot_id, uint64_t board_id, uint8_t pass, name publisher);
+
+
+    void sync_ballot_header(const ballot& bal, name publisher);
+
+    void sync_ballot_header(const ballot& bal, const leaderboard& board);
 
-    bool close_leaderboard(uint64_t board_id, uint8_t pass, name publisher);
+    void write_ballot_header(const ballot_header& header, name publisher);
 
 
     asset get_vote_weight(name voter, symbol voting_token);
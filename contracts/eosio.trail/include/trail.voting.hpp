@@ -119,6 +119,37 @@ struct [[eosio::table, eosio::contract("eosio.trail")]] leaderboard {
         (begin_time)(end_time)(status))
 };
 
+//NOTE: ballot headers MUST be scoped by name("eosio.trail").value, keyed by ballot_id
+// fixed size summary of the proposal or leaderboard a ballot refers to, kept in sync by Trail
+// so readers can check status and timing without deserializing candidate lists
+struct [[eosio::table, eosio::contract("eosio.trail")]] ballot_header {
+    uint64_t ballot_id;
+    uint8_t table_id;
+    uint64_t reference_id;
+    symbol voting_symbol;
+    uint8_t status;
+
+    uint32_t begin_time;
+    uint32_t end_time;
+    uint8_t available_seats; //NOTE: leaderboards only
+    uint16_t candidate_count; //NOTE: leaderboards only
+    uint32_t unique_voters; //NOTE: leaderboards only, counted here while voting is open
+
+    uint64_t primary_key() const { return ballot_id; }
+    EOSLIB_SERIALIZE(ballot_header, (ballot_id)(table_id)(reference_id)(voting_symbol)(status)
+        (begin_time)(end_time)(available_seats)(candidate_count)(unique_voters))
+};
+
+//NOTE: tallies MUST be scoped by board_id, keyed by candidate direction
+// live leaderboard votes, settled into leaderboard.candidates when the ballot is closed
+struct [[eosio::table, eosio::contract("eosio.trail")]] tally {
+    uint16_t direction;
+    int64_t votes; //NOTE: amount in the leaderboard's voting_symbol
+
+    uint64_t primary_key() const { return direction; }
+    EOSLIB_SERIALIZE(tally, (direction)(votes))
+};
+
 /**
  * NOTE: totals vector mappings:
  *     totals[0] => total proposals
@@ -164,12 +195,16 @@ struct [[eosio::table("environment"), eosio::contract("eosio.trail")]] env {
 
 typedef multi_index<name("ballots"), ballot> ballots_table;
 
+typedef multi_index<name("ballotheader"), ballot_header> ballotheaders_table;
+
 typedef multi_index<name("proposals"), proposal> proposals_table;
 
 typedef multi_index<name("elections"), election> elections_table;
 
 typedef multi_index<name("leaderboards"), leaderboard> leaderboards_table;
 
+typedef multi_index<name("tallies"), tally> tallies_table;
+
 typedef multi_index<name("votereceipts"), vote_receipt> votereceipts_table;
 
 //typedef multi_index<name("proxreceipts"), proxy_receipt> proxyreceipts_table;
@@ -192,4 +227,18 @@ bool is_ballot(uint64_t ballot_id) {
     return false;
 }
 
+//NOTE: leaderboard candidates with live tallies applied, tallies are empty once the ballot is closed
+vector<candidate> get_tallied_candidates(const leaderboard& board) {
+    auto candidates = board.candidates;
+    tallies_table tallies(name("eosio.trail"), board.board_id);
+
+    for (const auto& t : tallies) {
+        if (t.direction < candidates.size()) {
+            candidates[t.direction].votes += asset(t.votes, board.voting_symbol);
+        }
+    }
+
+    return candidates;
+}
+
 #pragma endregion Helper_Functions
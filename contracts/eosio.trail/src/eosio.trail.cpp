@@ -628,12 +628,23 @@ void trail::castvote(name voter, uint64_t ballot_id, uint16_t direction) {
             //vote_success = vote_for_election(voter, ballot_id, bal.reference_id, direction);
             break;
         case 2 : 
-            vote_success = vote_for_leaderboard(voter, ballot_id, bal.reference_id, direction);
+            vote_success = vote_for_leaderboard(voter, ballot_id, bal.reference_id, {direction});
             break;
     }
 
 }
 
+void trail::castvotes(name voter, uint64_t ballot_id, vector<uint16_t> directions) {
+    require_auth(voter);
+
+    ballots_table ballots(_self, _self.value);
+    auto b = ballots.find(ballot_id);
+    check(b != ballots.end(), "ballot with given ballot_id doesn't exist");
+    check(b->table_id == 2, "ballot type doesn't support multiple directions");
+
+    vote_for_leaderboard(voter, ballot_id, b->reference_id, directions);
+}
+
 void trail::deloldvotes(name voter, uint16_t num_to_delete) {
     require_auth(voter);
     check(num_to_delete > uint16_t(0), "must delete greater than 0 receipts");
@@ -710,6 +721,8 @@ void trail::regballot(name publisher, uint8_t ballot_type, symbol voting_symbol,
         a.reference_id = new_ref_id;
     });
 
+    sync_ballot_header(ballot{new_ballot_id, ballot_type, new_ref_id}, publisher);
+
     print("\nBallot ID: ", new_ballot_id);
 }
 
@@ -741,6 +754,12 @@ void trail::unregballot(name publisher, uint64_t ballot_id) {
 
     if (del_success) {
         ballots.erase(b);
+
+        ballotheaders_table headers(_self, _self.value);
+        auto h = headers.find(ballot_id);
+        if (h != headers.end()) {
+            headers.erase(h);
+        }
     }
 
     print("\nBallot ID Deleted: ", bal.ballot_id);
@@ -786,10 +805,56 @@ void trail::addcandidate(name publisher, uint64_t ballot_id, name new_candidate,
     leaderboards.modify(*l, same_payer, [&]( auto& a ) {
         a.candidates.push_back(new_candidate_struct);
     });
+    sync_ballot_header(bal, *l);
 
     print("\nAdd Candidate: SUCCESS");
 }
 
+void trail::addcands(name publisher, uint64_t ballot_id, vector<candidate> new_candidates) {
+    require_auth(publisher);
+    check(!new_candidates.empty(), "no candidates to add");
+
+    ballots_table ballots(_self, _self.value);
+    auto b = ballots.find(ballot_id);
+    check(b != ballots.end(), "ballot with given ballot_id doesn't exist");
+    auto bal = *b;
+    check(bal.table_id == 2, "ballot type doesn't support candidates");
+
+    leaderboards_table leaderboards(_self, _self.value);
+    auto l = leaderboards.find(bal.reference_id);
+    check(l != leaderboards.end(), "leaderboard doesn't exist");
+    check(l->available_seats > 0, "num_seats must be a non-zero number");
+    check(l->publisher == publisher, "cannot add candidate to another account's leaderboard");
+    check(current_time_point().sec_since_epoch() < l->begin_time , "cannot add candidates once voting has begun");
+
+    //NOTE: sorted name lists keep the duplicate checks at O((n + k) log n) for the whole page
+    vector<uint64_t> members;
+    members.reserve(l->candidates.size());
+    for (const auto& c : l->candidates)
+        members.push_back(c.member.value);
+    std::sort(members.begin(), members.end());
+
+    vector<uint64_t> page;
+    page.reserve(new_candidates.size());
+    for (auto& c : new_candidates) {
+        check(is_account(c.member), "new candidate is not an account");
+        check(!std::binary_search(members.begin(), members.end(), c.member.value), "candidate already in leaderboard");
+        page.push_back(c.member.value);
+
+        c.votes = asset(0, l->voting_symbol);
+        c.status = 0;
+    }
+    std::sort(page.begin(), page.end());
+    check(std::adjacent_find(page.begin(), page.end()) == page.end(), "candidate already in leaderboard");
+
+    leaderboards.modify(l, same_payer, [&]( auto& a ) {
+        a.candidates.insert(a.candidates.end(), new_candidates.begin(), new_candidates.end());
+    });
+    sync_ballot_header(bal, *l);
+
+    print("\nAdd Candidates: SUCCESS");
+}
+
 //TODO: refactor for elections when implemented
 void trail::setallcands(name publisher, uint64_t ballot_id, vector<candidate> new_candidates) {
     require_auth(publisher);
@@ -812,6 +877,7 @@ void trail::setallcands(name publisher, uint64_t ballot_id, vector<candidate> ne
     leaderboards.modify(l, same_payer, [&]( auto& a ) {
         a.candidates = new_candidates;
     });
+    sync_ballot_header(bal, *l);
 
     print("\nSet All Candidates: SUCCESS");
 }
@@ -876,6 +942,7 @@ void trail::rmvcandidate(name publisher, uint64_t ballot_id, name candidate) {
     leaderboards.modify(*l, same_payer, [&]( auto& a ) {
         a.candidates = new_candidates;
     });
+    sync_ballot_header(bal, *l);
 
     print("\nRemove Candidate: SUCCESS");
 }
@@ -900,6 +967,7 @@ void trail::setseats(name publisher, uint64_t ballot_id, uint8_t num_seats) {
     leaderboards.modify(l, same_payer, [&]( auto& a ) {
         a.available_seats = num_seats;
     });
+    sync_ballot_header(bal, *l);
 
     print("\nSet Available Seats: SUCCESS");
 }
@@ -923,10 +991,12 @@ void trail::closeballot(name publisher, uint64_t ballot_id, uint8_t pass) {
             //close_success = close_election(bal.reference_id, pass);
             break;
         case 2: 
-            close_success = close_leaderboard(bal.reference_id, pass, publisher);
+            close_success = close_leaderboard(bal.ballot_id, bal.reference_id, pass, publisher);
             break;
     }
 
+    sync_ballot_header(bal, publisher);
+
     print("\nBallot ID Closed: ", bal.ballot_id);
 }
 
@@ -963,6 +1033,7 @@ void trail::nextcycle(name publisher, uint64_t ballot_id, uint32_t new_begin_tim
         a.cycle_count += 1;
         a.status = 0;
     });
+    sync_ballot_header(bal, publisher);
 
     print("\nNext Cycle: SUCCESS");
 }
@@ -1212,15 +1283,22 @@ bool trail::delete_leaderboard(uint64_t board_id, name publisher) {
     return true;
 }
 
-bool trail::vote_for_leaderboard(name voter, uint64_t ballot_id, uint64_t board_id, uint16_t direction) {
-    leaderboards_table leaderboards(_self, _self.value);
-    auto b = leaderboards.find(board_id);
-    check(b != leaderboards.end(), "leaderboard doesn't exist");
-    auto board = *b;
-	print("\nboard.candidates.size(): ", board.candidates.size());
-	check(direction < board.candidates.size(), "direction must map to an existing candidate in the leaderboard struct");
+//NOTE: reads the ballot header instead of the leaderboard and only writes the voted candidates' tallies,
+// all directions share one weight lookup and one receipt write
+bool trail::vote_for_leaderboard(name voter, uint64_t ballot_id, uint64_t board_id, const vector<uint16_t>& directions) {
+    check(!directions.empty(), "directions cannot be empty");
+
+    ballotheaders_table headers(_self, _self.value);
+    auto h = headers.find(ballot_id);
+    check(h != headers.end(), "ballot header doesn't exist");
+    auto board = *h;
     check(env_struct.time_now >= board.begin_time && env_struct.time_now <= board.end_time, "ballot voting window not open");
 
+    for (auto itr = directions.begin(); itr != directions.end(); itr++) {
+        check(*itr < board.candidate_count, "direction must map to an existing candidate in the leaderboard struct");
+        check(std::find(directions.begin(), itr, *itr) == itr, "directions cannot contain duplicates");
+    }
+
     votereceipts_table votereceipts(_self, voter.value);
     auto vr_itr = votereceipts.find(ballot_id);
 
@@ -1235,12 +1313,9 @@ bool trail::vote_for_leaderboard(name voter, uint64_t ballot_id, uint64_t board_
 
     if (vr_itr == votereceipts.end()) { //NOTE: voter hasn't voted on ballot before
 
-        vector<uint16_t> new_directions;
-        new_directions.emplace_back(direction);
-
         votereceipts.emplace(voter, [&]( auto& a ){
             a.ballot_id = ballot_id;
-            a.directions = new_directions;
+            a.directions = directions;
             a.weight = vote_weight;
             a.expiration = board.end_time;
         });
@@ -1251,51 +1326,134 @@ bool trail::vote_for_leaderboard(name voter, uint64_t ballot_id, uint64_t board_
         auto vr = *vr_itr;
 		auto reg = *r;
 
-        if (vr.expiration == board.end_time && !has_direction(direction, vr.directions)) { //NOTE: hasn't voted for candidate before
+        if (vr.expiration == board.end_time) {
             new_voter = 0;
-            vr.directions.emplace_back(direction);
+
+            for (uint16_t direction : directions) {
+                if (has_direction(direction, vr.directions)) { //NOTE: vote already exists for candidate (recasting)
+                    check(reg.settings.is_recastable, "token registry disallows vote recasting");
+                    check(true == false, "Feature currently disabled"); //NOTE: temp fix
+                }
+                vr.directions.emplace_back(direction); //NOTE: hasn't voted for candidate before
+            }
 
             votereceipts.modify(vr_itr, same_payer, [&]( auto& a ) {
                 a.directions = vr.directions;
             });
 
             print("\nVote Recast: SUCCESS");
-
-        } else if (vr.expiration == board.end_time && has_direction(direction, vr.directions)) { //NOTE: vote already exists for candidate (recasting)
-			check(reg.settings.is_recastable, "token registry disallows vote recasting");
-            check(true == false, "Feature currently disabled"); //NOTE: temp fix
-            new_voter = 0;
-		}
+        }
         
     }
 
-    //NOTE: update leaderboard with new weight
-    board.candidates[direction].votes += vote_weight;
+    //NOTE: update tallies with new weight, a tally row is shared by every voter so trail pays for it
+    tallies_table tallies(_self, board_id);
 
-    leaderboards.modify(b, same_payer, [&]( auto& a ) {
-        a.candidates = board.candidates;
-        a.unique_voters += new_voter;
-    });
+    for (uint16_t direction : directions) {
+        auto t = tallies.find(direction);
+
+        if (t == tallies.end()) {
+            tallies.emplace(_self, [&]( auto& a ) {
+                a.direction = direction;
+                a.votes = vote_weight.amount;
+            });
+        } else {
+            tallies.modify(t, same_payer, [&]( auto& a ) {
+                a.votes += vote_weight.amount;
+            });
+        }
+    }
+
+    if (new_voter) {
+        headers.modify(h, same_payer, [&]( auto& a ) {
+            a.unique_voters += new_voter;
+        });
+    }
 
     return true;
 }
 
-bool trail::close_leaderboard(uint64_t board_id, uint8_t pass, name publisher) {
+bool trail::close_leaderboard(uint64_t ballot_id, uint64_t board_id, uint8_t pass, name publisher) {
     leaderboards_table leaderboards(_self, _self.value);
     auto b = leaderboards.find(board_id);
     check(b != leaderboards.end(), "leaderboard doesn't exist");
-    auto board = *b;
 
-    check(current_time_point().sec_since_epoch() > board.end_time, "cannot close leaderboard while voting is still open");
-    check(board.publisher == publisher, "cannot close another account's leaderboard");
+    check(current_time_point().sec_since_epoch() > b->end_time, "cannot close leaderboard while voting is still open");
+    check(b->publisher == publisher, "cannot close another account's leaderboard");
+
+    //NOTE: settle tallies into the candidate list, erasing them frees trail's RAM
+    auto candidates = get_tallied_candidates(*b);
+    tallies_table tallies(_self, board_id);
+    for (auto t = tallies.begin(); t != tallies.end(); ) {
+        t = tallies.erase(t);
+    }
+
+    ballotheaders_table headers(_self, _self.value);
+    auto h = headers.find(ballot_id);
 
     leaderboards.modify(b, same_payer, [&]( auto& a ) {
+        a.candidates = candidates;
         a.status = pass;
+        if (h != headers.end()) {
+            a.unique_voters = h->unique_voters;
+        }
     });
 
     return true;
 }
 
+//NOTE: header fields other than unique_voters only change through ballot actions
+void trail::sync_ballot_header(const ballot& bal, name publisher) {
+    switch (bal.table_id) {
+        case 0 : {
+            proposals_table proposals(_self, _self.value);
+            auto p = proposals.find(bal.reference_id);
+            check(p != proposals.end(), "proposal doesn't exist");
+            check(p->publisher == publisher, "cannot sync another account's ballot");
+
+            write_ballot_header(ballot_header{
+                bal.ballot_id, bal.table_id, bal.reference_id, p->no_count.symbol, p->status,
+                p->begin_time, p->end_time, 0, 0, 0
+            }, publisher);
+            break;
+        }
+        case 2 : {
+            leaderboards_table leaderboards(_self, _self.value);
+            auto l = leaderboards.find(bal.reference_id);
+            check(l != leaderboards.end(), "leaderboard doesn't exist");
+            check(l->publisher == publisher, "cannot sync another account's ballot");
+
+            sync_ballot_header(bal, *l);
+            break;
+        }
+    }
+}
+
+void trail::sync_ballot_header(const ballot& bal, const leaderboard& board) {
+    write_ballot_header(ballot_header{
+        bal.ballot_id, bal.table_id, bal.reference_id, board.voting_symbol, board.status,
+        board.begin_time, board.end_time, board.available_seats, uint16_t(board.candidates.size()),
+        board.unique_voters
+    }, board.publisher);
+}
+
+void trail::write_ballot_header(const ballot_header& header, name publisher) {
+    ballotheaders_table headers(_self, _self.value);
+    auto h = headers.find(header.ballot_id);
+
+    if (h == headers.end()) {
+        headers.emplace(publisher, [&]( auto& a ) {
+            a = header;
+        });
+    } else {
+        headers.modify(h, same_payer, [&]( auto& a ) {
+            auto unique_voters = a.unique_voters; //NOTE: counted by votes, the leaderboard copy is only settled at close
+            a = header;
+            a.unique_voters = unique_voters;
+        });
+    }
+}
+
 asset trail::get_vote_weight(name voter, symbol voting_symbol) {
 
     balances_table balances(_self, voting_symbol.code().raw());
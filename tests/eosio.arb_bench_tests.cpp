@@ -0,0 +1,309 @@
+#include <boost/test/unit_test.hpp>
+#include <eosio/testing/tester.hpp>
+#include <eosio/chain/abi_serializer.hpp>
+#include <eosio/chain/wast_to_wasm.hpp>
+
+#include <Runtime/Runtime.h>
+#include <iomanip>
+#include <cstdlib>
+
+#include <fc/variant_object.hpp>
+#include <fc/io/json.hpp>
+#include <fc/filesystem.hpp>
+#include <fc/crypto/sha256.hpp>
+#include "contracts.hpp"
+#include "test_symbol.hpp"
+#include "eosio.arb_tester.hpp"
+
+#include <iostream>
+
+using namespace eosio::testing;
+using namespace eosio;
+using namespace eosio::chain;
+using namespace eosio::testing;
+using namespace fc;
+using namespace std;
+
+using mvo = fc::mutable_variant_object;
+
+// Cost sweeps for the eosio.arb actions whose work grows with their inputs.
+// Every sample is written to the report at ARB_BENCH_REPORT (default: eosio.arb_bench_report.json).
+// The most expensive transaction of each sample is checked against the committed baseline
+// (eosio.arb_bench_baseline.json, or ARB_BENCH_BASELINE). A baseline is a report from a reference run,
+// refresh it by copying the report over it when a change is expected to move the numbers.
+//
+// The sweeps build into their own bench_test target and are not registered with ctest:
+//   ./bench_test --run_test=eosio_arb_bench_tests
+
+//NOTE: cpu time varies between runs, net and ram usage are deterministic and may not exceed the baseline
+const double CPU_TOLERANCE = 0.25;
+
+const uint8_t MAX_UNREAD_CLAIMS = 21;
+
+vector<fc::variant>& arb_bench_samples() {
+	static vector<fc::variant> samples;
+	return samples;
+}
+
+// baseline samples keyed by action, param and n
+const map<string, fc::variant_object>& arb_bench_baseline() {
+	static map<string, fc::variant_object> baseline = [] {
+		map<string, fc::variant_object> samples;
+		const char* env = std::getenv("ARB_BENCH_BASELINE");
+		fc::path path(env ? std::string(env) : contracts::util::arb_bench_baseline());
+		if (fc::exists(path)) {
+			for (const auto& sample : fc::json::from_file(path)["samples"].get_array()) {
+				const auto& obj = sample.get_object();
+				samples[obj["action"].as_string() + "/" + obj["param"].as_string() + "/" + obj["n"].as_string()] = obj;
+			}
+		}
+		return samples;
+	}();
+	return baseline;
+}
+
+class eosio_arb_bench_tester : public eosio_arb_tester {
+public:
+
+	// CIDv0 link for an arbitrary sha2-256 digest, so sweeps aren't limited to the fixed links
+	string bench_link(uint32_t seed) {
+		auto digest = fc::sha256::hash(std::string("arb bench ") + std::to_string(seed));
+		vector<char> multihash = { char(0x12), char(0x20) };
+		multihash.insert(multihash.end(), digest.data(), digest.data() + digest.data_size());
+		return fc::to_base58(multihash.data(), multihash.size());
+	}
+
+	vector<string> bench_links(uint32_t first_seed, uint32_t count) {
+		vector<string> links;
+		for (uint32_t i = 0; i < count; i++) {
+			links.emplace_back(bench_link(first_seed + i));
+		}
+		return links;
+	}
+
+	// records one sample over every transaction an action needed, the checks use the most expensive one
+	void record(const string& action, const string& param, uint32_t n, const vector<transaction_trace_ptr>& traces) {
+		uint64_t cpu_us = 0, net_bytes = 0, max_cpu_us = 0, max_net_bytes = 0;
+		int64_t ram_bytes = 0, max_ram_bytes = 0;
+
+		for (const auto& trace : traces) {
+			int64_t trx_ram_bytes = 0;
+			for (const auto& at : trace->action_traces) {
+				for (const auto& delta : at.account_ram_deltas) {
+					trx_ram_bytes += delta.delta;
+				}
+			}
+
+			cpu_us += trace->receipt->cpu_usage_us;
+			net_bytes += trace->net_usage;
+			ram_bytes += trx_ram_bytes;
+			max_cpu_us = std::max<uint64_t>(max_cpu_us, trace->receipt->cpu_usage_us);
+			max_net_bytes = std::max<uint64_t>(max_net_bytes, trace->net_usage);
+			max_ram_bytes = std::max(max_ram_bytes, trx_ram_bytes);
+		}
+
+		arb_bench_samples().emplace_back(mvo()
+			("action", action)
+			("param", param)
+			("n", n)
+			("transactions", traces.size())
+			("cpu_us", cpu_us)
+			("net_bytes", net_bytes)
+			("ram_bytes", ram_bytes)
+			("max_cpu_us", max_cpu_us)
+			("max_net_bytes", max_net_bytes)
+			("max_ram_bytes", max_ram_bytes)
+		);
+		write_report();
+
+		string key = action + "/" + param + "/" + std::to_string(n);
+		auto base = arb_bench_baseline().find(key);
+		if (base == arb_bench_baseline().end()) {
+			BOOST_TEST_MESSAGE("no baseline for " << key << ", max_cpu_us " << max_cpu_us);
+			return;
+		}
+
+		const auto& b = base->second;
+		uint64_t cpu_limit = uint64_t(b["max_cpu_us"].as_uint64() * (1 + CPU_TOLERANCE));
+		BOOST_CHECK_MESSAGE(max_cpu_us <= cpu_limit, key << " max_cpu_us " << max_cpu_us << " over " << cpu_limit);
+		BOOST_CHECK_MESSAGE(max_net_bytes <= b["max_net_bytes"].as_uint64(), key << " max_net_bytes " << max_net_bytes);
+		BOOST_CHECK_MESSAGE(max_ram_bytes <= b["max_ram_bytes"].as_int64(), key << " max_ram_bytes " << max_ram_bytes);
+	}
+
+	void write_report() {
+		const char* path = std::getenv("ARB_BENCH_REPORT");
+		fc::json::save_to_file(mvo()
+			("contract", "eosio.arb")
+			("samples", arb_bench_samples()),
+			fc::path(std::string(path ? path : "eosio.arb_bench_report.json")));
+	}
+
+	void fund_claimant() {
+		transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+		transfer(claimant.value, N(eosio.arb), asset::from_string("500.0000 TLOS"), "");
+		produce_blocks();
+	}
+
+	// files and readies a case with the given claims, then seats the given panel
+	uint64_t open_case(uint64_t case_id, const vector<string>& links, const vector<name>& panel) {
+		filecase(claimant, links[0], lang_codes, respondant);
+		if (links.size() > 1) {
+			addclaims(case_id, vector<string>(links.begin() + 1, links.end()), claimant);
+		}
+		readycase(case_id, claimant);
+		produce_blocks();
+
+		for (const auto& arb : panel) {
+			assigntocase(case_id, arb, assigner);
+		}
+		produce_blocks();
+		return case_id;
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(eosio_arb_bench_tests)
+
+BOOST_FIXTURE_TEST_CASE( claims_per_case, eosio_arb_bench_tester ) try {
+	elect_arbitrators(1, 10);
+	newarbstatus(AVAILABLE, test_voters[0]);
+	fund_claimant();
+
+	uint64_t case_id = 0;
+	uint32_t seed = 0;
+	for (uint32_t n : vector<uint32_t>{ 2, 5, 10, MAX_UNREAD_CLAIMS }) {
+		auto links = bench_links(seed, n);
+		seed += n;
+
+		filecase(claimant, links[0], lang_codes, respondant);
+		record("addclaims", "claims_per_case", n,
+			{ addclaims(case_id, vector<string>(links.begin() + 1, links.end()), claimant) });
+		readycase(case_id, claimant);
+		assigntocase(case_id, test_voters[0], assigner);
+		produce_blocks();
+
+		// the last claim is the worst case for the unread claims lookup
+		record("acceptclaim", "claims_per_case", n,
+			{ acceptclaim(case_id, test_voters[0], links.back(), ruling_links[0], A_TORT) });
+		produce_blocks();
+
+		vector<mvo> decisions;
+		for (uint32_t i = 0; i + 1 < n; i++) {
+			decisions.emplace_back(mvo()("claim_hash", links[i])("decision_link", ruling_links[0])("decision_class", A_TORT));
+		}
+		record("acceptclaims", "claims_per_case", n - 1, { acceptclaims(case_id, test_voters[0], decisions) });
+		produce_blocks();
+
+		BOOST_REQUIRE_EQUAL(n, get_casefile(case_id)["accepted_claims"].as<vector<uint64_t>>().size());
+		case_id++;
+	}
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( arbs_per_case, eosio_arb_bench_tester ) try {
+	const uint8_t max_panel = 7;
+	elect_arbitrators(max_panel, 10);
+	for (uint8_t i = 0; i < max_panel; i++) {
+		newarbstatus(AVAILABLE, test_voters[i]);
+	}
+	fund_claimant();
+
+	uint64_t case_id = 0;
+	for (uint32_t n : { 1, 3, 5, 7 }) {
+		vector<name> panel(test_voters.begin(), test_voters.begin() + n);
+		open_case(case_id, bench_links(case_id * 100, 1), panel);
+
+		for (uint32_t i = 0; i + 1 < n; i++) {
+			advancecase(case_id, panel[i]);
+		}
+
+		// the last approval advances the case
+		record("advancecase", "arbs_per_case", n, { advancecase(case_id, panel.back()) });
+		produce_blocks();
+
+		BOOST_REQUIRE_EQUAL(HEARING, get_casefile(case_id)["case_status"].as<uint8_t>());
+		case_id++;
+	}
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( open_cases_per_arb, eosio_arb_bench_tester ) try {
+	// one arbitrator is never dismissed so eosio.arb@major keeps a member
+	elect_arbitrators(5, 10);
+	for (uint8_t i = 0; i < 5; i++) {
+		newarbstatus(AVAILABLE, test_voters[i]);
+	}
+	fund_claimant();
+
+	uint64_t case_id = 0;
+	uint8_t arb_index = 0;
+	for (uint32_t n : { 1, 10, 25, 50 }) {
+		name arb = test_voters[arb_index++];
+		for (uint32_t i = 0; i < n; i++, case_id++) {
+			open_case(case_id, bench_links(case_id, 1), { arb });
+		}
+		BOOST_REQUIRE_EQUAL(n, get_arbitrator(arb)["open_cases"].as<uint32_t>());
+
+		record("dismissarb", "open_cases_per_arb", n, { dismissarb(arb, true) });
+		produce_blocks();
+
+		vector<transaction_trace_ptr> cleanups;
+		while (!get_arb_cleanup(arb).is_null()) {
+			cleanups.emplace_back(cleanarbs(25, bad_actor));
+			produce_blocks();
+		}
+		if (!cleanups.empty()) {
+			record("cleanarbs", "open_cases_per_arb", n, cleanups);
+		}
+
+		BOOST_REQUIRE_EQUAL(0, get_arbitrator(arb)["open_cases"].as<uint32_t>());
+	}
+} FC_LOG_AND_RETHROW()
+
+//NOTE: every n runs on a fresh chain, the tester only has NUM_VOTERS accounts for nominees and voters
+BOOST_AUTO_TEST_CASE( nominees_per_election ) try {
+	const symbol vote_sym = symbol(4, "VOTE");
+	const symbol tlos_sym = symbol(4, "TLOS");
+	const uint8_t num_voters = 10;
+
+	for (uint32_t n : { 5, 10, 20, 50, 100 }) {
+		eosio_arb_bench_tester t;
+		t.setconfig(100, 300, 300, 86400 * 10, { int64_t(1), int64_t(2), int64_t(3), int64_t(4) });
+		t.init_election();
+		t.produce_blocks();
+
+		auto cbid = t.get_config()["current_ballot_id"].as_uint64();
+
+		t.voter_map(0, n, [&](auto& account) {
+			t.regarb(account, t.claim_link1);
+			t.candaddlead(account, t.claim_link1);
+			t.produce_blocks();
+		});
+
+		t.produce_block(fc::seconds(300));
+		t.produce_blocks();
+
+		vector<uint16_t> directions;
+		for (uint32_t i = 0; i < n; i++) {
+			directions.emplace_back(uint16_t(i));
+		}
+		t.voter_map(n, n + num_voters, [&](auto& account) {
+			t.regvoter(account, vote_sym);
+			t.mirrorcast(account, tlos_sym);
+			t.castvotes(account, cbid, directions);
+			t.produce_blocks();
+		});
+
+		t.produce_block(fc::seconds(300));
+		t.produce_blocks();
+
+		// endelection resumes across calls until every phase is done
+		vector<transaction_trace_ptr> traces;
+		do {
+			traces.emplace_back(t.endelection(t.test_voters[0]));
+			t.produce_blocks();
+		} while (t.get_config()["election_phase"].as<uint8_t>() != 0);
+
+		t.record("endelection", "nominees_per_election", n, traces);
+		BOOST_REQUIRE_EQUAL(false, t.get_arbitrator(t.test_voters[n - 1]).is_null());
+	}
+} FC_LOG_AND_RETHROW()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,4 +1,5 @@
 #include "eosio.trail_tester.hpp"
+#include <fc/crypto/base58.hpp>
 
 using namespace eosio::testing;
 using namespace eosio;
@@ -110,6 +111,11 @@ public:
 
 #pragma region get_tables
 
+    fc::variant get_stats() {
+        vector<char> data = get_row_by_account(N(eosio.arb), N(eosio.arb), N(stats), N(stats));
+        return data.empty() ? fc::variant() : abi_ser.binary_to_variant("arb_stats", data, abi_serializer_max_time);
+    }
+
     fc::variant get_config() {
         vector<char> data = get_row_by_account(N(eosio.arb), N(eosio.arb), N(config), N(config));
         return data.empty() ? fc::variant() : abi_ser.binary_to_variant("config", data, abi_serializer_max_time);
@@ -130,33 +136,104 @@ public:
         return data.empty() ? fc::variant() : abi_ser.binary_to_variant("casefile", data, abi_serializer_max_time);
     }
 
-    fc::variant get_unread_claim(uint64_t casefile_id, uint8_t claim_id) {
-        auto cf = get_casefile(casefile_id);
+    vector<mvo> get_unread_claims(uint64_t casefile_id) {
+        vector<mvo> unread_claims;
+        const auto& db = control->db();
+        const auto* t_id = db.find<eosio::chain::table_id_object, chain::by_code_scope_table>(
+            boost::make_tuple(N(eosio.arb), casefile_id, N(unreadclaims)));
+        if (!t_id) {
+            return unread_claims;
+        }
 
-        BOOST_REQUIRE_EQUAL(false, cf.is_null());
-        auto unread_claims = cf["unread_claims"].as < vector < mvo > > ();
-        return unread_claims[claim_id];
-        //vector<char> data = get_row_by_accounts(N(eosio.arb),N(eosio.arb), N(unread_claims), casefile_id);
-        //return data.empty()? fc::variant() : abi_ser.binary_to_variant("unread_claim", data, abi_serializer_max_time);
+        const auto& idx = db.get_index<chain::key_value_index, chain::by_scope_primary>();
+        for (auto itr = idx.lower_bound(boost::make_tuple(t_id->id, 0)); itr != idx.end() && itr->t_id == t_id->id; ++itr) {
+            vector<char> data(itr->value.data(), itr->value.data() + itr->value.size());
+            unread_claims.emplace_back(abi_ser.binary_to_variant("claim", data, abi_serializer_max_time).get_object());
+        }
+        return unread_claims;
     }
 
-    fc::variant get_unread_claim(uint64_t casefile_id, string claim_link) {
-        auto cf = get_casefile(casefile_id);
+    fc::variant get_unread_claim(uint64_t casefile_id, uint8_t claim_id) {
+        vector<char> data = get_row_by_account(N(eosio.arb), casefile_id, N(unreadclaims), claim_id);
+        return data.empty() ? fc::variant() : abi_ser.binary_to_variant("claim", data, abi_serializer_max_time);
+    }
 
-        BOOST_REQUIRE_EQUAL(false, cf.is_null());
-        auto unread_claims = cf["unread_claims"].as < vector < mvo > > ();
+    fc::variant get_unread_claim(uint64_t casefile_id, string claim_link) {
+        auto unread_claims = get_unread_claims(casefile_id);
 
         auto it = find_if(unread_claims.begin(), unread_claims.end(), [&](auto c) {
-            return claim_link == c["claim_summary"];
+            return to_cid(claim_link) == c["claim_summary"].as_string();
         });
         return it == unread_claims.end() ? fc::variant() : *it;
     }
 
+    fc::variant get_archived_case(uint64_t case_id) {
+        vector<char> data = get_row_by_account(N(eosio.arb), N(eosio.arb), N(archives), case_id);
+        return data.empty() ? fc::variant() : abi_ser.binary_to_variant("archived_case", data, abi_serializer_max_time);
+    }
+
+    fc::variant get_assignment(uint64_t assignment_id) {
+        vector<char> data = get_row_by_account(N(eosio.arb), N(eosio.arb), N(assignments), assignment_id);
+        return data.empty() ? fc::variant() : abi_ser.binary_to_variant("assignment", data, abi_serializer_max_time);
+    }
+
+    vector<fc::variant> get_events(const transaction_trace_ptr& trace) {
+        vector<fc::variant> events;
+        for (const auto& at : trace->action_traces) {
+            if (at.receiver == N(eosio.arb) && at.act.name == N(arbevent)) {
+                events.emplace_back(abi_ser.binary_to_variant("arbevent", at.act.data, abi_serializer_max_time));
+            }
+        }
+        return events;
+    }
+
+    fc::variant get_arb_cleanup(name arb) {
+        vector<char> data = get_row_by_account(N(eosio.arb), N(eosio.arb), N(arbcleanup), arb);
+        return data.empty() ? fc::variant() : abi_ser.binary_to_variant("arb_cleanup", data, abi_serializer_max_time);
+    }
+
+    vector<name> get_major_accounts() {
+        const auto& perm = control->get_authorization_manager().get_permission({N(eosio.arb), N(major)});
+        vector<name> accounts;
+        for (const auto& a : perm.auth.accounts) {
+            accounts.emplace_back(a.permission.actor);
+        }
+        return accounts;
+    }
+
+    //NOTE: contract tables store ipfs links as binary cids, rendered as hex by the abi serializer
+    string to_cid(const string& ipfs_url) {
+        return ipfs_url.empty() ? string() : fc::to_hex(fc::from_base58(ipfs_url));
+    }
+
     fc::variant get_claim(uint64_t claim_id) {
         vector<char> data = get_row_by_account(N(eosio.arb), N(eosio.arb), N(claims), claim_id);
         return data.empty() ? fc::variant() : abi_ser.binary_to_variant("claim", data, abi_serializer_max_time);
     }
 
+    // claimindex rows for one document, the doc_hash is the sha2-256 digest at the end of the cid
+    vector<mvo> get_claim_refs(const string& claim_link) {
+        vector<mvo> claim_refs;
+        const auto& db = control->db();
+        const auto* t_id = db.find<eosio::chain::table_id_object, chain::by_code_scope_table>(
+            boost::make_tuple(N(eosio.arb), N(eosio.arb), N(claimindex)));
+        if (!t_id) {
+            return claim_refs;
+        }
+
+        auto cid = to_cid(claim_link);
+        auto doc_hash = cid.substr(cid.size() - 64);
+        const auto& idx = db.get_index<chain::key_value_index, chain::by_scope_primary>();
+        for (auto itr = idx.lower_bound(boost::make_tuple(t_id->id, 0)); itr != idx.end() && itr->t_id == t_id->id; ++itr) {
+            vector<char> data(itr->value.data(), itr->value.data() + itr->value.size());
+            auto ref = abi_ser.binary_to_variant("claim_ref", data, abi_serializer_max_time).get_object();
+            if (ref["doc_hash"].as_string() == doc_hash) {
+                claim_refs.emplace_back(ref);
+            }
+        }
+        return claim_refs;
+    }
+
     #pragma endregion get_tables
 
 	void elect_arbitrators(uint8_t num_arbitrators, uint8_t num_voters) {
@@ -318,6 +395,17 @@ public:
         return push_transaction(trx);
     }
 
+    transaction_trace_ptr addclaims(uint64_t case_id, vector<string> claim_links, name claimant) {
+        signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(addclaims), vector<permission_level>{{claimant, config::active_name}}, mvo()
+            ("case_id", case_id)
+            ("claim_links", claim_links)
+            ("claimant", claimant)));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(claimant, "active"), control->get_chain_id());
+        return push_transaction(trx);
+    }
+
     transaction_trace_ptr removeclaim(uint64_t case_id, string claim_hash, name claimant) {
         signed_transaction trx;
         trx.actions.emplace_back(get_action(N(eosio.arb), N(removeclaim), vector<permission_level>{{claimant, config::active_name}}, mvo()
@@ -349,6 +437,19 @@ public:
         return push_transaction(trx);
     }
 
+    transaction_trace_ptr fileready(name claimant, vector<string> claim_links, vector <uint8_t> lang_codes, fc::optional<name> respondant ) {
+        signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(fileready), vector<permission_level>{{claimant, config::active_name}}, mvo()
+            ("claimant", claimant)
+            ("claim_links", claim_links)
+            ("lang_codes", lang_codes)
+            ("respondant", respondant)
+            ));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(claimant, "active"), control->get_chain_id());
+        return push_transaction(trx);
+    }
+
     //note: case progression
 
     transaction_trace_ptr assigntocase(uint64_t case_id, name arb_to_assign, name assigner) {
@@ -412,6 +513,29 @@ public:
         return push_transaction(trx);
     }
 
+    transaction_trace_ptr dismissclaims(uint64_t case_id, name assigned_arb, vector<string> claim_hashes, string memo) {
+        signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(dismissclaims), vector<permission_level>{{assigned_arb, config::active_name}}, mvo()
+            ("case_id", case_id)
+            ("assigned_arb", assigned_arb)
+            ("claim_hashes", claim_hashes)
+            ("memo", memo)));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(assigned_arb, "active"), control->get_chain_id());
+        return push_transaction(trx);
+    }
+
+    transaction_trace_ptr acceptclaims(uint64_t case_id, name assigned_arb, vector<mvo> decisions) {
+        signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(acceptclaims), vector<permission_level>{{assigned_arb, config::active_name}}, mvo()
+            ("case_id", case_id)
+            ("assigned_arb", assigned_arb)
+            ("decisions", decisions)));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(assigned_arb, "active"), control->get_chain_id());
+        return push_transaction(trx);
+    }
+
     transaction_trace_ptr acceptclaim(uint64_t case_id, name assigned_arb, string claim_hash, string decision_link, uint8_t decision_class) {
         signed_transaction trx;
         trx.actions.emplace_back(get_action(N(eosio.arb), N(acceptclaim), vector<permission_level>{{assigned_arb, config::active_name}}, mvo()
@@ -504,6 +628,16 @@ public:
         return push_transaction(trx);
 	}
 
+	transaction_trace_ptr assigncase(uint64_t case_id, name actor) {
+		signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(assigncase), vector<permission_level>{{actor, config::active_name}}, mvo()
+            ("case_id", case_id)
+		));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(actor, "active"), control->get_chain_id());
+        return push_transaction(trx);
+	}
+
     transaction_trace_ptr dismissarb(name arb, bool remove_from_cases) {
         signed_transaction trx;
         trx.actions.emplace_back(get_action(N(eosio.arb), N(dismissarb), vector<permission_level>{{N(eosio), config::active_name}},
@@ -516,6 +650,72 @@ public:
         return push_transaction(trx);
     }
 
+    transaction_trace_ptr setpanelsize(uint8_t arbs_per_case) {
+        signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(setpanelsize), vector<permission_level>{{N(eosio), config::active_name}},
+                mvo()
+					("arbs_per_case", arbs_per_case)
+		));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(N(eosio), "active"), control->get_chain_id());
+        return push_transaction(trx);
+    }
+
+    transaction_trace_ptr setdeadlines(vector<uint32_t> case_deadlines) {
+        signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(setdeadlines), vector<permission_level>{{N(eosio), config::active_name}},
+                mvo()
+					("case_deadlines", case_deadlines)
+		));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(N(eosio), "active"), control->get_chain_id());
+        return push_transaction(trx);
+    }
+
+	transaction_trace_ptr setlangcodes(name arbitrator, vector<uint8_t> lang_codes) {
+		signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(setlangcodes), vector<permission_level>{{arbitrator, config::active_name}}, mvo()
+            ("arbitrator", arbitrator)
+            ("lang_codes", lang_codes)
+		));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(arbitrator, "active"), control->get_chain_id());
+        return push_transaction(trx);
+	}
+
+    transaction_trace_ptr archivecases(uint16_t max, name actor) {
+        signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(archivecases), vector<permission_level>{{actor, config::active_name}},
+                mvo()
+					("max", max)
+		));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(actor, "active"), control->get_chain_id());
+        return push_transaction(trx);
+    }
+
+    transaction_trace_ptr cleanarbs(uint16_t max, name actor) {
+        signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(cleanarbs), vector<permission_level>{{actor, config::active_name}},
+                mvo()
+					("max", max)
+		));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(actor, "active"), control->get_chain_id());
+        return push_transaction(trx);
+    }
+
+    transaction_trace_ptr sweepcases(uint16_t max, name actor) {
+        signed_transaction trx;
+        trx.actions.emplace_back(get_action(N(eosio.arb), N(sweepcases), vector<permission_level>{{actor, config::active_name}},
+                mvo()
+					("max", max)
+		));
+        set_transaction_headers(trx);
+        trx.sign(get_private_key(actor, "active"), control->get_chain_id());
+        return push_transaction(trx);
+    }
+
     #pragma endregion actions
 
 	#pragma region native_structs
@@ -574,6 +774,38 @@ public:
         CLOSED  // 3
     };
 
+    enum election_phase : uint8_t
+    {
+        PHASE_IDLE,  // 0
+        PHASE_SEAT,  // 1
+        PHASE_PERMS, // 2
+        PHASE_CLOSE, // 3
+        PHASE_CLEAR, // 4
+        PHASE_CARRY  // 5
+    };
+
+    enum case_event : uint8_t
+    {
+        CASE_FILED,         // 0
+        CLAIM_ADDED,        // 1
+        CLAIM_REMOVED,      // 2
+        CASE_SHREDDED,      // 3
+        CASE_READIED,       // 4
+        ARB_ASSIGNED,       // 5
+        CLAIM_RESPONDED,    // 6
+        CLAIM_DISMISSED,    // 7
+        CLAIM_ACCEPTED,     // 8
+        CASE_APPROVED,      // 9
+        CASE_ADVANCED,      // 10
+        RULING_SET,         // 11
+        CASE_DISMISSED,     // 12
+        ARB_RECUSED,        // 13
+        ARB_REMOVED,        // 14
+        CASE_DELETED,       // 15
+        CASE_ARCHIVED,      // 16
+        CASE_OVERDUE        // 17
+    };
+
     enum lang_code : uint8_t
     {
         ENGL, //0 English
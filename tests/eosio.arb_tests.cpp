@@ -57,6 +57,12 @@ BOOST_FIXTURE_TEST_CASE( check_config_setter, eosio_arb_tester ) try {
 		   ("last_time_edited", config["last_time_edited"].as<uint32_t>()) 
 		   ("current_ballot_id", 0)
 		   ("auto_start_election", 0)
+		   ("arbs_per_case", 0)
+		   ("election_phase", 0)
+		   ("election_cursor", 0)
+		   ("election_cutoff", 0)
+		   ("occupied_seats", 0)
+		   ("case_deadlines", vector<uint32_t>())
    );
    
    produce_blocks(1);
@@ -89,6 +95,12 @@ BOOST_FIXTURE_TEST_CASE( check_config_setter, eosio_arb_tester ) try {
 		   ("last_time_edited", now())
 		   ("current_ballot_id", 1)
 		   ("auto_start_election", 1)
+		   ("arbs_per_case", 0)
+		   ("election_phase", 0)
+		   ("election_cursor", 0)
+		   ("election_cutoff", 0)
+		   ("occupied_seats", 0)
+		   ("case_deadlines", vector<uint32_t>())
    );
    produce_blocks(1);
    
@@ -204,11 +216,11 @@ BOOST_FIXTURE_TEST_CASE( register_unregister_endelection, eosio_arb_tester ) try
    // check integrity
    auto c = get_nominee(dropout.value);
    BOOST_REQUIRE_EQUAL( c["nominee_name"].as<name>(), dropout );
-   BOOST_REQUIRE_EQUAL( c["credentials_link"],  credentials );
+   BOOST_REQUIRE_EQUAL( c["credentials_link"].as_string(),  to_cid(credentials) );
    
    c = get_nominee(candidate.value);
    BOOST_REQUIRE_EQUAL( c["nominee_name"].as<name>(), candidate );
-   BOOST_REQUIRE_EQUAL( c["credentials_link"],  credentials );
+   BOOST_REQUIRE_EQUAL( c["credentials_link"].as_string(),  to_cid(credentials) );
 
    // dropout unregisters
    candrmvlead( dropout );
@@ -229,7 +241,7 @@ BOOST_FIXTURE_TEST_CASE( register_unregister_endelection, eosio_arb_tester ) try
    candaddlead( candidate, credentials );
    c = get_nominee(candidate.value);
    BOOST_REQUIRE_EQUAL( c["nominee_name"].as<name>(), candidate );
-   BOOST_REQUIRE_EQUAL( c["credentials_link"],  credentials );
+   BOOST_REQUIRE_EQUAL( c["credentials_link"].as_string(),  to_cid(credentials) );
    produce_blocks(1);
 
    // candidates cannot register multiple times
@@ -334,12 +346,13 @@ BOOST_FIXTURE_TEST_CASE( register_unregister_endelection, eosio_arb_tester ) try
    BOOST_REQUIRE_EQUAL(false, arb.is_null());
    BOOST_REQUIRE_EQUAL(arb["arb"].as<name>(), candidate);
    BOOST_REQUIRE_EQUAL(arb["arb_status"].as<uint16_t>(), UNAVAILABLE_STATUS);
-   BOOST_REQUIRE_EQUAL(arb["credentials_link"].as<std::string>(), credentials);
+   BOOST_REQUIRE_EQUAL(arb["credentials_link"].as<std::string>(), to_cid(credentials));
 //    BOOST_REQUIRE_EQUAL(arb["term_length"].as<uint32_t>(), expected_term_length);
 //    candidate is not in the candidates table anymore
    BOOST_REQUIRE_EQUAL(true, get_nominee(candidate.value).is_null());
    
    config = get_config();
+   BOOST_REQUIRE_EQUAL(1, config["occupied_seats"].as<uint16_t>());
    auto next_cbid = config["current_ballot_id"].as_uint64();   
 
    BOOST_REQUIRE_EQUAL(true, config["auto_start_election"]);
@@ -414,6 +427,7 @@ BOOST_FIXTURE_TEST_CASE( register_unregister_endelection, eosio_arb_tester ) try
    BOOST_REQUIRE_EQUAL(arb["arb_status"], SEAT_EXPIRED_STATUS);
    
    config = get_config();
+   BOOST_REQUIRE_EQUAL(0, config["occupied_seats"].as<uint16_t>());
    cbid = config["current_ballot_id"].as_uint64();   
 
    ballot = get_ballot(cbid);
@@ -516,16 +530,19 @@ BOOST_FIXTURE_TEST_CASE( full_election, eosio_arb_tester ) try {
    auto leaderboard = get_leaderboard(bid);
    auto lid = leaderboard["board_id"].as_uint64();
 
+   // live votes are kept in the tallies table until the leaderboard is closed
    for(int i = 0 ; i < 3 ; i++){
       REQUIRE_MATCHING_OBJECT(
          leaderboard["candidates"][i], 
          mvo()
             ("member", test_voters[i])
             ("info_link", credentials)
-            ("votes", expected_weights[i])
+            ("votes", zero_asset)
             ("status", uint8_t(0))
       );
+      BOOST_REQUIRE_EQUAL(expected_weights[i].get_amount(), get_tally(bid, i)["votes"].as<int64_t>());
    }
+   BOOST_REQUIRE_EQUAL(6, get_ballot_header(cbid)["unique_voters"].as<uint32_t>());
    
    // election period is over
    produce_block(fc::seconds(election_duration));
@@ -545,7 +562,7 @@ BOOST_FIXTURE_TEST_CASE( full_election, eosio_arb_tester ) try {
    BOOST_REQUIRE_EQUAL(false, arb.is_null());
    BOOST_REQUIRE_EQUAL(arb["arb"].as<name>(), candidate1);
    BOOST_REQUIRE_EQUAL(arb["arb_status"].as<uint16_t>(), UNAVAILABLE_STATUS);
-   BOOST_REQUIRE_EQUAL(arb["credentials_link"].as<std::string>(), credentials);
+   BOOST_REQUIRE_EQUAL(arb["credentials_link"].as<std::string>(), to_cid(credentials));
 //    BOOST_REQUIRE_EQUAL(arb["term_length"].as<uint32_t>(), expected_term_length);
    auto c = get_nominee(candidate1.value);
    BOOST_REQUIRE_EQUAL(c.is_null(), true);
@@ -555,7 +572,7 @@ BOOST_FIXTURE_TEST_CASE( full_election, eosio_arb_tester ) try {
    BOOST_REQUIRE_EQUAL(false, arb.is_null());
    BOOST_REQUIRE_EQUAL(arb["arb"].as<name>(), candidate2);
    BOOST_REQUIRE_EQUAL(arb["arb_status"].as<uint16_t>(), UNAVAILABLE_STATUS);
-   BOOST_REQUIRE_EQUAL(arb["credentials_link"].as<std::string>(), credentials);
+   BOOST_REQUIRE_EQUAL(arb["credentials_link"].as<std::string>(), to_cid(credentials));
 //    BOOST_REQUIRE_EQUAL(arb["term_length"].as<uint32_t>(), expected_term_length); //TODO: determine term length test based on new struct fields
    c = get_nominee(candidate2.value);
    BOOST_REQUIRE_EQUAL(c.is_null(), true);
@@ -578,6 +595,13 @@ BOOST_FIXTURE_TEST_CASE( full_election, eosio_arb_tester ) try {
    leaderboard = get_leaderboard(bid);
    lid = leaderboard["board_id"].as_uint64();
 
+   // closing the leaderboard settles the tallies into its candidates
+   for(int i = 0 ; i < 3 ; i++){
+      BOOST_REQUIRE_EQUAL(expected_weights[i], leaderboard["candidates"][i]["votes"].as<asset>());
+      BOOST_REQUIRE_EQUAL(true, get_tally(bid, i).is_null());
+   }
+   BOOST_REQUIRE_EQUAL(6, leaderboard["unique_voters"].as<uint32_t>());
+
    // there is no new election in progress since no seats are left
    BOOST_REQUIRE_EQUAL(cbid, previous_cbid);
    BOOST_REQUIRE_EQUAL(false, config["auto_start_election"]);
@@ -688,16 +712,19 @@ BOOST_FIXTURE_TEST_CASE( tiebreaker, eosio_arb_tester ) try {
    auto leaderboard = get_leaderboard(bid);
    auto lid = leaderboard["board_id"].as_uint64();
 
+   // live votes are kept in the tallies table until the leaderboard is closed
    for(int i = 0 ; i < 3 ; i++){
       REQUIRE_MATCHING_OBJECT(
          leaderboard["candidates"][i], 
          mvo()
             ("member", test_voters[i])
             ("info_link", credentials)
-            ("votes", expected_weights[i])
+            ("votes", zero_asset)
             ("status", uint8_t(0))
       );
+      BOOST_REQUIRE_EQUAL(expected_weights[i].get_amount(), get_tally(bid, i)["votes"].as<int64_t>());
    }
+   BOOST_REQUIRE_EQUAL(6, get_ballot_header(cbid)["unique_voters"].as<uint32_t>());
    
    // election period is over
    produce_block(fc::seconds(election_duration));
@@ -714,7 +741,7 @@ BOOST_FIXTURE_TEST_CASE( tiebreaker, eosio_arb_tester ) try {
    BOOST_REQUIRE_EQUAL(false, arb.is_null());
    BOOST_REQUIRE_EQUAL(arb["arb"].as<name>(), candidate1);
    BOOST_REQUIRE_EQUAL(arb["arb_status"].as<uint16_t>(), UNAVAILABLE_STATUS);
-   BOOST_REQUIRE_EQUAL(arb["credentials_link"].as<std::string>(), credentials);
+   BOOST_REQUIRE_EQUAL(arb["credentials_link"].as<std::string>(), to_cid(credentials));
 //    BOOST_REQUIRE_EQUAL(arb["term_length"].as<uint32_t>(), expected_term_length);
    auto c = get_nominee(candidate1.value);
    BOOST_REQUIRE_EQUAL(c.is_null(), true);
@@ -758,6 +785,153 @@ BOOST_FIXTURE_TEST_CASE( tiebreaker, eosio_arb_tester ) try {
 
 } FC_LOG_AND_RETHROW()
 
+BOOST_FIXTURE_TEST_CASE( election_batches, eosio_arb_tester ) try {
+	const symbol vote_sym = symbol(4, "VOTE");
+	const symbol tlos_sym = symbol(4, "TLOS");
+	const uint32_t num_nominees = 50, num_winners = 20;
+
+	// 30 seats, 50 nominees, only the first 20 nominees get votes
+	setconfig(30, 300, 300, 86400 * 10, { int64_t(1), int64_t(2), int64_t(3), int64_t(4) });
+	init_election();
+	produce_blocks();
+
+	auto cbid = get_config()["current_ballot_id"].as_uint64();
+	voter_map(0, num_nominees, [&](auto& account) {
+		regarb(account, claim_link1);
+		candaddlead(account, claim_link1);
+		produce_blocks();
+	});
+
+	produce_block(fc::seconds(300));
+	produce_blocks();
+
+	vector<uint16_t> directions;
+	for (uint16_t i = 0; i < num_winners; i++) {
+		directions.emplace_back(i);
+	}
+	voter_map(num_nominees, num_nominees + 10, [&](auto& account) {
+		regvoter(account, vote_sym);
+		mirrorcast(account, tlos_sym);
+		castvotes(account, cbid, directions);
+		produce_blocks();
+	});
+
+	produce_block(fc::seconds(300));
+	produce_blocks();
+
+	// first call seats from the first 25 candidates only
+	endelection(test_voters[0]);
+	produce_blocks();
+	BOOST_REQUIRE_EQUAL(PHASE_SEAT, get_config()["election_phase"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(25, get_config()["election_cursor"].as<uint64_t>());
+
+	// nothing that depends on the election state can run until it is finalized
+	BOOST_REQUIRE_EXCEPTION(
+		regarb(test_voters[100], claim_link1),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("an election is being finalized, call endelection until it completes")
+	);
+	BOOST_REQUIRE_EXCEPTION(
+		candaddlead(test_voters[30], claim_link1),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("an election is being finalized, call endelection until it completes")
+	);
+	BOOST_REQUIRE_EXCEPTION(
+		setconfig(30, 300, 300, 86400 * 10, { int64_t(1), int64_t(2), int64_t(3), int64_t(4) }),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("an election is being finalized, call endelection until it completes")
+	);
+
+	// anyone can push the remaining batches
+	uint8_t calls = 1;
+	while (get_config()["election_phase"].as<uint8_t>() != PHASE_IDLE) {
+		endelection(test_voters[num_nominees]);
+		produce_blocks();
+		calls++;
+	}
+	BOOST_REQUIRE_EQUAL(4, calls);
+
+	for (uint32_t i = 0; i < num_nominees; i++) {
+		BOOST_REQUIRE_EQUAL(i < num_winners, !get_arbitrator(test_voters[i]).is_null());
+		BOOST_REQUIRE_EQUAL(i >= num_winners, !get_nominee(test_voters[i].value).is_null());
+	}
+	BOOST_REQUIRE_EQUAL(num_winners, get_config()["occupied_seats"].as<uint16_t>());
+
+	// the leftover nominees were carried to the next election for the 10 open seats
+	auto new_cbid = get_config()["current_ballot_id"].as_uint64();
+	BOOST_REQUIRE_EQUAL(cbid + 1, new_cbid);
+	auto board = get_leaderboard(get_ballot(new_cbid)["reference_id"].as_uint64());
+	BOOST_REQUIRE_EQUAL(10, board["available_seats"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(num_nominees - num_winners, board["candidates"].get_array().size());
+
+	regarb(test_voters[100], claim_link1);
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( election_carry_opened, eosio_arb_tester ) try {
+	const symbol vote_sym = symbol(4, "VOTE");
+	const symbol tlos_sym = symbol(4, "TLOS");
+	const uint32_t num_nominees = 50, num_winners = 20;
+
+	setconfig(30, 300, 300, 86400 * 10, { int64_t(1), int64_t(2), int64_t(3), int64_t(4) });
+	init_election();
+	produce_blocks();
+
+	auto cbid = get_config()["current_ballot_id"].as_uint64();
+	voter_map(0, num_nominees, [&](auto& account) {
+		regarb(account, claim_link1);
+		candaddlead(account, claim_link1);
+		produce_blocks();
+	});
+
+	produce_block(fc::seconds(300));
+	produce_blocks();
+
+	vector<uint16_t> directions;
+	for (uint16_t i = 0; i < num_winners; i++) {
+		directions.emplace_back(i);
+	}
+	voter_map(num_nominees, num_nominees + 10, [&](auto& account) {
+		regvoter(account, vote_sym);
+		mirrorcast(account, tlos_sym);
+		castvotes(account, cbid, directions);
+		produce_blocks();
+	});
+
+	produce_block(fc::seconds(300));
+	produce_blocks();
+
+	// two seating calls, the third one opens the next ballot and carries the first page of nominees
+	for (int i = 0; i < 3; i++) {
+		endelection(test_voters[0]);
+		produce_blocks();
+	}
+	BOOST_REQUIRE_EQUAL(PHASE_CARRY, get_config()["election_phase"].as<uint8_t>());
+
+	auto new_cbid = get_config()["current_ballot_id"].as_uint64();
+	auto board_id = get_ballot(new_cbid)["reference_id"].as_uint64();
+	auto carried = get_leaderboard(board_id)["candidates"].get_array().size();
+	BOOST_REQUIRE_EQUAL(true, carried > 0 && carried < num_nominees - num_winners);
+
+	// election_start passes before the rest is carried, trail would reject any more candidates
+	produce_block(fc::seconds(300));
+	produce_blocks();
+
+	endelection(test_voters[num_nominees]);
+	produce_blocks();
+	BOOST_REQUIRE_EQUAL(PHASE_IDLE, get_config()["election_phase"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(0, get_config()["election_cursor"].as<uint64_t>());
+	BOOST_REQUIRE_EQUAL(carried, get_leaderboard(board_id)["candidates"].get_array().size());
+
+	// nominees that missed the ballot are still registered
+	for (uint32_t i = num_winners; i < num_nominees; i++) {
+		BOOST_REQUIRE_EQUAL(false, get_nominee(test_voters[i].value).is_null());
+	}
+
+	// the contract is unlocked again
+	setconfig(30, 300, 300, 86400 * 10, { int64_t(1), int64_t(2), int64_t(3), int64_t(4) });
+	regarb(test_voters[100], claim_link1);
+} FC_LOG_AND_RETHROW()
+
 BOOST_FIXTURE_TEST_CASE( case_setup_flow, eosio_arb_tester ) try {
 
     // choose 3 claimants
@@ -802,7 +976,7 @@ BOOST_FIXTURE_TEST_CASE( case_setup_flow, eosio_arb_tester ) try {
     auto casef = get_casefile(uint64_t(0));
     auto cid = casef["case_id"].as_uint64();
     auto cstatus = casef["case_status"];
-    auto cunread_claims = casef["unread_claims"];
+    auto cunread_claims = get_unread_claims(cid);
 
 	//TODO: assert respondant is empty in first case.
 
@@ -817,7 +991,7 @@ BOOST_FIXTURE_TEST_CASE( case_setup_flow, eosio_arb_tester ) try {
 
     // Check new case file has one unread claims.
    //  std::cout << "Unread Claim Count for new case: " << cunread_claims.size() << endl;
-    BOOST_REQUIRE_EQUAL(casef["unread_claims"].size(), 1 );
+    BOOST_REQUIRE_EQUAL(get_unread_claims(cid).size(), 1 );
 
     // claimant who filed case is the only one allowed to add additional claims to casefile
     BOOST_REQUIRE_EXCEPTION(
@@ -833,8 +1007,7 @@ BOOST_FIXTURE_TEST_CASE( case_setup_flow, eosio_arb_tester ) try {
     produce_blocks(1);
 
     // Check unread claim was added to casefile
-    casef = get_casefile(uint64_t(0));
-    BOOST_REQUIRE_EQUAL(casef["unread_claims"].size(), 4 );
+    BOOST_REQUIRE_EQUAL(get_unread_claims(cid).size(), 4 );
 
 
     // Retrieve 1st unread claim for first case and verify info
@@ -842,7 +1015,7 @@ BOOST_FIXTURE_TEST_CASE( case_setup_flow, eosio_arb_tester ) try {
     REQUIRE_MATCHING_OBJECT (unread_claim,
          mvo()
          ("claim_id",0)
-         ("claim_summary", claim_links[0])
+         ("claim_summary", to_cid(claim_links[0]))
          ("decision_link", "")
          ("response_link", "")
          ("decision_class", 0)
@@ -914,15 +1087,18 @@ BOOST_FIXTURE_TEST_CASE( assign_arb_flow, eosio_arb_tester ) try {
 	BOOST_REQUIRE_EQUAL(case_arbs.size(), 1);
 	BOOST_REQUIRE_EQUAL(case_arbs[0].as_string(), test_voters[0].to_string());
 
-	//NOTE: Arbitrator calls addarbs, in order to add new arbitrators.
-	addarbs(current_case_id, test_voters[0], 2);
+	BOOST_REQUIRE_EXCEPTION(
+		addarbs(current_case_id, test_voters[0], 2),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("not enough available arbitrators for this case")
+	);
 
-	//NOTE: this assumes that a demux or chain watching service catches the aboves call to addarbs
-	// and acts according to the arguments in the action
+	setlangcodes(test_voters[1], lang_codes);
+	setlangcodes(test_voters[2], lang_codes);
+	produce_blocks();
 
-	//NOTE: in this case the service would then call assigntocase twice
-	assigntocase(current_case_id, test_voters[1], assigner);
-	assigntocase(current_case_id, test_voters[2], assigner);
+	//NOTE: Arbitrator calls addarbs, in order to add new arbitrators.
+	addarbs(current_case_id, test_voters[0], 2);
 
 	cf = get_casefile(current_case_id);
 	case_arbs = cf["arbitrators"].as<vector<fc::variant>>();
@@ -1062,9 +1238,9 @@ BOOST_FIXTURE_TEST_CASE( advance_case, eosio_arb_tester ) try {
 	BOOST_REQUIRE_EQUAL(ENFORCEMENT, get_casefile(current_case_id)["case_status"].as<uint8_t>());
 	produce_blocks();
 
+	setlangcodes(test_voters[1], lang_codes);
+	setlangcodes(test_voters[2], lang_codes);
 	addarbs(current_case_id, test_voters[0], 2);
-	assigntocase(current_case_id, test_voters[1], assigner);
-	assigntocase(current_case_id, test_voters[2], assigner);
 	produce_blocks();
 
 	BOOST_REQUIRE_EXCEPTION(
@@ -1076,14 +1252,14 @@ BOOST_FIXTURE_TEST_CASE( advance_case, eosio_arb_tester ) try {
 	eosio_arb_tester::setruling(current_case_id, test_voters[0], claim_link1);
 	produce_blocks();
 
-	BOOST_REQUIRE_EQUAL(claim_link1, get_casefile(current_case_id)["case_ruling"].as_string());
+	BOOST_REQUIRE_EQUAL(to_cid(claim_link1), get_casefile(current_case_id)["case_ruling"].as_string());
 
 	advancecase(current_case_id, test_voters[0]);
 	
-	auto approvals = get_casefile(current_case_id)["approvals"].as<vector<fc::variant>>();
+	// approvals are a bitmask over the positions in the arbitrators vector
+	auto approvals = get_casefile(current_case_id)["approvals"].as<uint32_t>();
 
-	BOOST_REQUIRE_EQUAL(1, approvals.size());
-	BOOST_REQUIRE_EQUAL(test_voters[0], approvals[0].as_string());
+	BOOST_REQUIRE_EQUAL(0b001, approvals);
 	produce_blocks();
 
 	// cout << "casefile: " << get_casefile(current_case_id) << endl;
@@ -1095,21 +1271,48 @@ BOOST_FIXTURE_TEST_CASE( advance_case, eosio_arb_tester ) try {
     );
 
 	advancecase(current_case_id, test_voters[1]);
-	approvals = get_casefile(current_case_id)["approvals"].as<vector<fc::variant>>();
+	approvals = get_casefile(current_case_id)["approvals"].as<uint32_t>();
 
-	BOOST_REQUIRE_EQUAL(2, approvals.size());
-	BOOST_REQUIRE_EQUAL(test_voters[0], approvals[0].as_string());
-	BOOST_REQUIRE_EQUAL(test_voters[1], approvals[1].as_string());
+	BOOST_REQUIRE_EQUAL(0b011, approvals);
 	produce_blocks();
 
 	advancecase(current_case_id, test_voters[2]);
-	approvals = get_casefile(current_case_id)["approvals"].as<vector<fc::variant>>();
+	approvals = get_casefile(current_case_id)["approvals"].as<uint32_t>();
 
-	BOOST_REQUIRE_EQUAL(0, approvals.size());
+	BOOST_REQUIRE_EQUAL(0, approvals);
 	BOOST_REQUIRE_EQUAL(RESOLVED, get_casefile(current_case_id)["case_status"].as<uint8_t>());
 	produce_blocks();
 
-	//TODO: advance case to resolve, should pass
+	// closed cases are compacted into archives by anyone
+	auto resolved = get_casefile(current_case_id);
+	archivecases(1, bad_actor);
+	archivecases(1, bad_actor);
+	produce_blocks();
+
+	BOOST_REQUIRE_EXCEPTION(
+		archivecases(1, bad_actor),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("no closed cases to archive")
+	);
+
+	BOOST_REQUIRE_EQUAL(true, get_casefile(0).is_null());
+	BOOST_REQUIRE_EQUAL(true, get_casefile(current_case_id).is_null());
+	BOOST_REQUIRE_EQUAL(DISMISSED, get_archived_case(0)["case_status"].as<uint8_t>());
+
+	// the archive keeps the ruling's sha2-256 digest, the last 32 bytes of its cid
+	auto ruling_cid = to_cid(claim_link1);
+	auto archived = get_archived_case(current_case_id);
+	BOOST_REQUIRE_EQUAL(false, archived.is_null());
+	REQUIRE_MATCHING_OBJECT(archived, mvo()
+		("case_id", current_case_id)
+		("case_status", RESOLVED)
+		("claimant", claimant)
+		("respondant", respondant)
+		("ruling_hash", ruling_cid.substr(ruling_cid.size() - 64))
+		("filed_time", resolved["filed_time"])
+		("closed_time", resolved["last_edit"])
+		("accepted_claims", resolved["accepted_claims"])
+	);
 } FC_LOG_AND_RETHROW()
 
 BOOST_FIXTURE_TEST_CASE( respondant_response, eosio_arb_tester ) try {
@@ -1150,15 +1353,15 @@ BOOST_FIXTURE_TEST_CASE( respondant_response, eosio_arb_tester ) try {
 
 	auto claim = get_unread_claim(current_case_id, claim_link1);
 	BOOST_REQUIRE_EQUAL(false, claim.is_null());
-	BOOST_REQUIRE_EQUAL(claim["claim_summary"].as_string(), claim_link1);
-	BOOST_REQUIRE_EQUAL(claim["response_link"].as_string(), response_link1);
+	BOOST_REQUIRE_EQUAL(claim["claim_summary"].as_string(), to_cid(claim_link1));
+	BOOST_REQUIRE_EQUAL(claim["response_link"].as_string(), to_cid(response_link1));
 
 	respond(current_case_id, claim_link1, respondant, response_link2);
 
 	claim = get_unread_claim(current_case_id, claim_link1);
 	BOOST_REQUIRE_EQUAL(false, claim.is_null());
-	BOOST_REQUIRE_EQUAL(claim["claim_summary"].as_string(), claim_link1);
-	BOOST_REQUIRE_EQUAL(claim["response_link"].as_string(), response_link2);
+	BOOST_REQUIRE_EQUAL(claim["claim_summary"].as_string(), to_cid(claim_link1));
+	BOOST_REQUIRE_EQUAL(claim["response_link"].as_string(), to_cid(response_link2));
 
 	// file case with no respondant
 	filecase(claimant, claim_link1, lang_codes, {});
@@ -1234,6 +1437,63 @@ BOOST_FIXTURE_TEST_CASE( recuse_arb, eosio_arb_tester ) try {
 
 } FC_LOG_AND_RETHROW()
 
+BOOST_FIXTURE_TEST_CASE( recuse_mid_panel, eosio_arb_tester ) try {
+	elect_arbitrators(8, 10); // test_voters 0-7 are arbitrators, 8-17 voted for 0-7
+	uint64_t current_case_id = 0;
+
+	BOOST_REQUIRE_EXCEPTION(
+		setpanelsize(33),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("arbs_per_case exceeds the max panel size")
+    );
+
+	filecase(claimant, claim_link1, lang_codes, respondant);
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+	readycase(current_case_id, claimant);
+	produce_blocks();
+
+	for (int i = 0; i < 4; i++) {
+		newarbstatus(AVAILABLE, test_voters[i]);
+		assigntocase(current_case_id, test_voters[i], assigner);
+	}
+	produce_blocks();
+
+	// seats 0, 2 and 3 approve, seat 1 hasn't
+	advancecase(current_case_id, test_voters[0]);
+	advancecase(current_case_id, test_voters[2]);
+	advancecase(current_case_id, test_voters[3]);
+	produce_blocks();
+	BOOST_REQUIRE_EQUAL(0b1101, get_casefile(current_case_id)["approvals"].as<uint32_t>());
+
+	// removing seat 1 shifts the approvals of seats 2 and 3 down one bit
+	recuse(current_case_id, "conflict of interest", test_voters[1]);
+	produce_blocks();
+
+	auto cf = get_casefile(current_case_id);
+	auto case_arbs = cf["arbitrators"].as<vector<name>>();
+	BOOST_REQUIRE_EQUAL(3, case_arbs.size());
+	BOOST_REQUIRE_EQUAL(test_voters[2], case_arbs[1]);
+	BOOST_REQUIRE_EQUAL(0b0111, cf["approvals"].as<uint32_t>());
+	BOOST_REQUIRE_EQUAL(CASE_INVESTIGATION, cf["case_status"].as<uint8_t>());
+
+	BOOST_REQUIRE_EXCEPTION(
+		advancecase(current_case_id, test_voters[3]),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("arbitrator has already approved advancing this case")
+    );
+
+	// dismissing the middle seat keeps seats 0 and 3 approved
+	dismissarb(test_voters[2], true);
+	produce_blocks();
+
+	cf = get_casefile(current_case_id);
+	case_arbs = cf["arbitrators"].as<vector<name>>();
+	BOOST_REQUIRE_EQUAL(2, case_arbs.size());
+	BOOST_REQUIRE_EQUAL(test_voters[3], case_arbs[1]);
+	BOOST_REQUIRE_EQUAL(0b0011, cf["approvals"].as<uint32_t>());
+} FC_LOG_AND_RETHROW()
+
 BOOST_FIXTURE_TEST_CASE( dismiss_case, eosio_arb_tester ) try {
 
     //TODO: filecase
@@ -1250,7 +1510,7 @@ BOOST_FIXTURE_TEST_CASE( dismiss_case, eosio_arb_tester ) try {
     addclaim(current_case_id, claim_links[2], claimant);
     addclaim(current_case_id, claim_links[3], claimant);
     auto cf = get_casefile(current_case_id);
-    BOOST_REQUIRE_EQUAL( cf["unread_claims"].size() , uint8_t(4)  );
+    BOOST_REQUIRE_EQUAL( get_unread_claims(current_case_id).size() , uint8_t(4)  );
 
     //TODO: transfer funds
     transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
@@ -1319,7 +1579,7 @@ BOOST_FIXTURE_TEST_CASE( accept_dismiss_claims, eosio_arb_tester ) try {
     addclaim(current_case_id, claim_links[2], claimant);
     addclaim(current_case_id, claim_links[3], claimant);
     auto cf = get_casefile(current_case_id);
-    BOOST_REQUIRE_EQUAL( cf["unread_claims"].size() , uint8_t(4)  );
+    BOOST_REQUIRE_EQUAL( get_unread_claims(current_case_id).size() , uint8_t(4)  );
 
     BOOST_REQUIRE_EXCEPTION(
             dismissclaim(current_case_id, claimant, claim_links[0], "The claim is not valid.  Dismissed" ),
@@ -1378,9 +1638,9 @@ BOOST_FIXTURE_TEST_CASE( accept_dismiss_claims, eosio_arb_tester ) try {
     REQUIRE_MATCHING_OBJECT (claim,
             mvo()
     ("claim_id",0)
-    ("claim_summary", claim_links[0])
+    ("claim_summary", to_cid(claim_links[0]))
     ("decision_link", "")
-    ("response_link", response_links[0])
+    ("response_link", to_cid(response_links[0]))
     ("decision_class", 0)
     );
 
@@ -1392,10 +1652,10 @@ BOOST_FIXTURE_TEST_CASE( accept_dismiss_claims, eosio_arb_tester ) try {
 
     REQUIRE_MATCHING_OBJECT (claim,
             mvo()
-    ("claim_id",0)
-    ("claim_summary", claim_links[1])
+    ("claim_id",1)
+    ("claim_summary", to_cid(claim_links[1]))
     ("decision_link", "")
-    ("response_link", response_links[1])
+    ("response_link", to_cid(response_links[1]))
     ("decision_class", 0)
     );
 	//dismissclaim
@@ -1440,9 +1700,9 @@ BOOST_FIXTURE_TEST_CASE( accept_dismiss_claims, eosio_arb_tester ) try {
    REQUIRE_MATCHING_OBJECT (claim_accepted,
                mvo()
                ("claim_id",0)
-               ("claim_summary", claim_links[1])
-               ("decision_link", ruling_links[1])
-               ("response_link", response_links[1])
+               ("claim_summary", to_cid(claim_links[1]))
+               ("decision_link", to_cid(ruling_links[1]))
+               ("response_link", to_cid(response_links[1]))
                ("decision_class", 9 )
    );
    BOOST_REQUIRE(true);
@@ -1542,7 +1802,13 @@ BOOST_FIXTURE_TEST_CASE( case_resolution, eosio_arb_tester ) try {
 
     cf = get_casefile(current_case_id);
     BOOST_REQUIRE_EQUAL ( cf["case_status"].as<uint8_t>(), RESOLVED );
-    BOOST_REQUIRE_EQUAL ( cf["case_ruling"].as_string(), ruling_links[0] );
+    BOOST_REQUIRE_EQUAL ( cf["case_ruling"].as_string(), to_cid(ruling_links[0]) );
+
+    // resolved case is moved from open to closed for the assigned arbitrator
+    auto arb = get_arbitrator(test_voters[0]);
+    BOOST_REQUIRE_EQUAL ( arb["open_cases"].as<uint32_t>(), 0 );
+    BOOST_REQUIRE_EQUAL ( arb["closed_cases"].as<uint32_t>(), 1 );
+    BOOST_REQUIRE_EQUAL ( true, get_assignment(0).is_null() );
 
 
 
@@ -1551,6 +1817,8 @@ BOOST_FIXTURE_TEST_CASE( case_resolution, eosio_arb_tester ) try {
 
 BOOST_FIXTURE_TEST_CASE( dismiss_arb, eosio_arb_tester ) try { //TODO: for peter
 	elect_arbitrators(8, 10); // test_voters 0-7 are arbitrators, 8-17 voted for 0-7
+	BOOST_REQUIRE_EQUAL(8, get_major_accounts().size());
+
 	newarbstatus(AVAILABLE, test_voters[0]);
 	newarbstatus(AVAILABLE, test_voters[1]);
 	BOOST_REQUIRE_EQUAL(AVAILABLE, get_arbitrator(test_voters[0])["arb_status"].as<uint8_t>());
@@ -1565,6 +1833,30 @@ BOOST_FIXTURE_TEST_CASE( dismiss_arb, eosio_arb_tester ) try { //TODO: for peter
     );
 
 	BOOST_REQUIRE_EQUAL(REMOVED, get_arbitrator(test_voters[0])["arb_status"].as<uint8_t>());
+
+	// removed arbitrator can't make itself available again
+	BOOST_REQUIRE_EXCEPTION(
+		newarbstatus(AVAILABLE, test_voters[0]),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("arbitrator is already removed or their seat has expired")
+    );
+
+	// only AVAILABLE and UNAVAILABLE can be set by an arbitrator
+	BOOST_REQUIRE_EXCEPTION(
+		newarbstatus(REMOVED, test_voters[1]),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("Supplied status code is invalid for this action")
+    );
+
+	// removed arbitrator loses its seat in eosio.arb@major
+	auto major_accounts = get_major_accounts();
+	BOOST_REQUIRE_EQUAL(7, major_accounts.size());
+	BOOST_REQUIRE(std::find(major_accounts.begin(), major_accounts.end(), test_voters[0]) == major_accounts.end());
+
+	// setconfig recounts the seats, a removed arbitrator holds its seat until the term ends
+	setconfig(20, 300, 300, 86400 * 10, { int64_t(1), int64_t(2), int64_t(3), int64_t(4) });
+	BOOST_REQUIRE_EQUAL(8, get_config()["occupied_seats"].as<uint16_t>());
+
 	uint64_t current_case_id = 0;
 	filecase(claimant, claim_link1, lang_codes, respondant);
 	produce_blocks();
@@ -1594,10 +1886,12 @@ BOOST_FIXTURE_TEST_CASE( dismiss_arb, eosio_arb_tester ) try { //TODO: for peter
 	BOOST_REQUIRE_EQUAL(test_voters[1].to_string(), case_arbs[0].to_string());
 
 	auto arb = get_arbitrator(test_voters[1]);
-	auto open_ids = arb["open_case_ids"].as<vector<uint64_t>>();
+	BOOST_REQUIRE_EQUAL(1, arb["open_cases"].as<uint32_t>());
 
-	BOOST_REQUIRE_EQUAL(1, open_ids.size());
-	BOOST_REQUIRE_EQUAL(current_case_id, open_ids[0]);
+	auto assignment = get_assignment(0);
+	BOOST_REQUIRE_EQUAL(false, assignment.is_null());
+	BOOST_REQUIRE_EQUAL(current_case_id, assignment["case_id"].as<uint64_t>());
+	BOOST_REQUIRE_EQUAL(test_voters[1], assignment["arb"].as<name>());
 
 	dismissarb(test_voters[1], true);
 
@@ -1607,9 +1901,778 @@ BOOST_FIXTURE_TEST_CASE( dismiss_arb, eosio_arb_tester ) try { //TODO: for peter
 	BOOST_REQUIRE_EQUAL(0, case_arbs.size());
 
 	arb = get_arbitrator(test_voters[1]);
-	open_ids = arb["open_case_ids"].as<vector<uint64_t>>();
+	BOOST_REQUIRE_EQUAL(0, arb["open_cases"].as<uint32_t>());
+	BOOST_REQUIRE_EQUAL(true, get_assignment(0).is_null());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( expired_arb_status, eosio_arb_tester ) try {
+	elect_arbitrators(2, 10);
+	newarbstatus(UNAVAILABLE, test_voters[0]);
+	BOOST_REQUIRE_EQUAL(UNAVAILABLE, get_arbitrator(test_voters[0])["arb_status"].as<uint8_t>());
+
+	auto term_expiration = get_arbitrator(test_voters[0])["term_expiration"].as<uint32_t>();
+	produce_block(fc::seconds(term_expiration - control->head_block_time().sec_since_epoch() + 1));
+	produce_blocks();
+
+	BOOST_REQUIRE_EXCEPTION(
+		newarbstatus(AVAILABLE, test_voters[0]),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("arbitrator term expired")
+    );
+	BOOST_REQUIRE_EQUAL(UNAVAILABLE, get_arbitrator(test_voters[0])["arb_status"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(2, get_major_accounts().size());
+
+	// re-registering gives up the expired seat and its authority
+	regarb(test_voters[1], claim_link1);
+	produce_blocks();
+	auto major_accounts = get_major_accounts();
+	BOOST_REQUIRE_EQUAL(1, major_accounts.size());
+	BOOST_REQUIRE_EQUAL(test_voters[0], major_accounts[0]);
+
+	// the expiry sweep of the next election drops the other one, major falls back to eosio.arb@active
+	init_election();
+	produce_blocks();
+	BOOST_REQUIRE_EQUAL(SEAT_EXPIRED, get_arbitrator(test_voters[0])["arb_status"].as<uint8_t>());
+	major_accounts = get_major_accounts();
+	BOOST_REQUIRE_EQUAL(1, major_accounts.size());
+	BOOST_REQUIRE_EQUAL(std::string("eosio.arb"), major_accounts[0].to_string());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( dismiss_arb_cleanup, eosio_arb_tester ) try {
+	elect_arbitrators(2, 10);
+	newarbstatus(AVAILABLE, test_voters[0]);
+	setlangcodes(test_voters[0], lang_codes);
+	setpanelsize(1);
+	produce_blocks();
+
+	BOOST_REQUIRE_EXCEPTION(
+		cleanarbs(10, claimant),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("no arbitrators queued for cleanup")
+	);
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+
+	// one more case than dismissarb cleans up inline
+	const uint64_t num_cases = 26;
+	for (uint64_t id = 0; id < num_cases; id++) {
+		filecase(claimant, claim_link1, lang_codes, respondant);
+		readycase(id, claimant);
+		produce_blocks();
+	}
+	BOOST_REQUIRE_EQUAL(num_cases, get_arbitrator(test_voters[0])["open_cases"].as<uint32_t>());
+
+	// status changes right away, the leftover case is queued
+	dismissarb(test_voters[0], true);
+	produce_blocks();
+
+	auto arb = get_arbitrator(test_voters[0]);
+	BOOST_REQUIRE_EQUAL(REMOVED, arb["arb_status"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(1, arb["open_cases"].as<uint32_t>());
+	BOOST_REQUIRE_EQUAL(false, get_arb_cleanup(test_voters[0]).is_null());
+	BOOST_REQUIRE_EQUAL(0, get_casefile(0)["arbitrators"].as<vector<name>>().size());
+	BOOST_REQUIRE_EQUAL(1, get_casefile(num_cases - 1)["arbitrators"].as<vector<name>>().size());
+
+	BOOST_REQUIRE_EXCEPTION(
+		cleanarbs(0, claimant),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("max must be greater than 0")
+	);
+
+	cleanarbs(10, claimant);
+	produce_blocks();
+
+	BOOST_REQUIRE_EQUAL(0, get_arbitrator(test_voters[0])["open_cases"].as<uint32_t>());
+	BOOST_REQUIRE_EQUAL(true, get_arb_cleanup(test_voters[0]).is_null());
+	BOOST_REQUIRE_EQUAL(0, get_casefile(num_cases - 1)["arbitrators"].as<vector<name>>().size());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( ipfs_cid_links, eosio_arb_tester ) try {
+	// CIDv1 (base32, dag-pb) of the same sha2-256 digest as claim_link2
+	string claim_link_v1 = "bafybeibgnsixpguprf3g2rtbtersflmzytihsugkiwixeadgtrfvvoutru";
+
+	BOOST_REQUIRE_EXCEPTION(
+		filecase(claimant, "QmQveDjVxp9RAMowU5m8JddfmfjPhZsc5skqmB3x9awPr0", lang_codes, {}),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("invalid ipfs string, valid schema: <hash>")
+	);
+
+	BOOST_REQUIRE_EXCEPTION(
+		filecase(claimant, "bafybgibgnsixpguprf3g2rtbtersflmzytihsugkiwixeadgtrfvvoutru", lang_codes, {}),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("invalid ipfs string, valid schema: <hash>")
+	);
+
+	// same bytes as claim_link_v1 with a non-zero padding bit in the last character
+	BOOST_REQUIRE_EXCEPTION(
+		filecase(claimant, "bafybeibgnsixpguprf3g2rtbtersflmzytihsugkiwixeadgtrfvvoutrv", lang_codes, {}),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("invalid ipfs string, valid schema: <hash>")
+	);
+
+	filecase(claimant, claim_link_v1, lang_codes, {});
+	produce_blocks();
+
+	auto claims = get_unread_claims(0);
+	BOOST_REQUIRE_EQUAL(1, claims.size());
+	BOOST_REQUIRE_EQUAL(claims[0]["claim_summary"].as_string(), "0170" + to_cid(claim_link2));
+
+	// the CIDv0 form of the same digest is the same claim
+	BOOST_REQUIRE_EXCEPTION(
+		addclaim(0, claim_link2, claimant),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("ipfs hash exists in another claim")
+	);
+
+	addclaim(0, claim_link1, claimant);
+	removeclaim(0, claim_link2, claimant);
+	produce_blocks();
+
+	claims = get_unread_claims(0);
+	BOOST_REQUIRE_EQUAL(1, claims.size());
+	BOOST_REQUIRE_EQUAL(claims[0]["claim_summary"].as_string(), to_cid(claim_link1));
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( auto_assign_arbs, eosio_arb_tester ) try {
+	elect_arbitrators(4, 10);
+	for (uint8_t i = 0; i < 4; i++) {
+		newarbstatus(AVAILABLE, test_voters[i]);
+		setlangcodes(test_voters[i], i < 3 ? lang_codes : vector<uint8_t>{0});
+	}
+	produce_blocks();
+
+	// languages are stored as a bitset of lang_code
+	BOOST_REQUIRE_EQUAL(0b111, get_arbitrator(test_voters[0])["languages"].as<uint16_t>());
+	BOOST_REQUIRE_EQUAL(0b001, get_arbitrator(test_voters[3])["languages"].as<uint16_t>());
+
+	BOOST_REQUIRE_EXCEPTION(
+		setlangcodes(test_voters[3], {0, 9}),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("invalid language code")
+	);
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+
+	// disabled by default, readied cases wait for an assigner
+	filecase(claimant, claim_link1, lang_codes, respondant);
+	readycase(0, claimant);
+	produce_blocks();
+	BOOST_REQUIRE_EQUAL(AWAITING_ARBS, get_casefile(0)["case_status"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(0b111, get_casefile(0)["required_langs"].as<uint16_t>());
+
+	setpanelsize(1);
+	filecase(claimant, claim_link1, lang_codes, respondant);
+	readycase(1, claimant);
+	produce_blocks();
+
+	auto cf = get_casefile(1);
+	BOOST_REQUIRE_EQUAL(CASE_INVESTIGATION, cf["case_status"].as<uint8_t>());
+	auto first_panel = cf["arbitrators"].as<vector<name>>();
+	BOOST_REQUIRE_EQUAL(1, first_panel.size());
+	BOOST_REQUIRE(first_panel[0] != test_voters[3]);
+	BOOST_REQUIRE_EQUAL(1, get_arbitrator(first_panel[0])["open_cases"].as<uint32_t>());
+
+	// least loaded arbitrators that speak every case language are picked next
+	setpanelsize(2);
+	filecase(claimant, claim_link1, lang_codes, respondant);
+	readycase(2, claimant);
+	produce_blocks();
+
+	auto second_panel = get_casefile(2)["arbitrators"].as<vector<name>>();
+	BOOST_REQUIRE_EQUAL(2, second_panel.size());
+	for (const auto& arb : second_panel) {
+		BOOST_REQUIRE(arb != first_panel[0]);
+		BOOST_REQUIRE(arb != test_voters[3]);
+		BOOST_REQUIRE_EQUAL(1, get_arbitrator(arb)["open_cases"].as<uint32_t>());
+	}
+	BOOST_REQUIRE_EQUAL(0, get_arbitrator(test_voters[3])["open_cases"].as<uint32_t>());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( assign_lang_sets, eosio_arb_tester ) try {
+	elect_arbitrators(7, 10);
+
+	// bylangs order: 0b0001, 0b0010, 0b0100, 0b0101, 0b0110, 0b1000, 0b1111
+	vector<vector<uint8_t>> arb_langs = { {0}, {1}, {0, 2}, {2}, {1, 2}, {0, 1, 2, 3}, {3} };
+	for (uint8_t i = 0; i < arb_langs.size(); i++) {
+		newarbstatus(AVAILABLE, test_voters[i]);
+		setlangcodes(test_voters[i], arb_langs[i]);
+	}
+	produce_blocks();
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+
+	// French cases skip 0b0001, seek past 0b0101 and step over 0b0100 and 0b1000
+	setpanelsize(4);
+	fileready(claimant, {claim_link1}, {1}, respondant);
+	produce_blocks();
+
+	auto panel = get_casefile(0)["arbitrators"].as<vector<name>>();
+	BOOST_REQUIRE_EQUAL(3, panel.size());
+	BOOST_REQUIRE_EQUAL(test_voters[1], panel[0]);
+	BOOST_REQUIRE_EQUAL(test_voters[4], panel[1]);
+	BOOST_REQUIRE_EQUAL(test_voters[5], panel[2]);
+
+	// French and German cases only match 0b0110 and 0b1111
+	fileready(claimant, {claim_link2}, {1, 2}, respondant);
+	produce_blocks();
+
+	panel = get_casefile(1)["arbitrators"].as<vector<name>>();
+	BOOST_REQUIRE_EQUAL(2, panel.size());
+	BOOST_REQUIRE_EQUAL(test_voters[4], panel[0]);
+	BOOST_REQUIRE_EQUAL(test_voters[5], panel[1]);
+
+	for (auto i : { 0, 2, 3, 6 }) {
+		BOOST_REQUIRE_EQUAL(0, get_arbitrator(test_voters[i])["open_cases"].as<uint32_t>());
+	}
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( assign_case_retry, eosio_arb_tester ) try {
+	elect_arbitrators(3, 10);
+	setpanelsize(2);
+	produce_blocks();
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+
+	// nobody is available, the case waits for arbitrators
+	fileready(claimant, {claim_link1}, lang_codes, respondant);
+	produce_blocks();
+	BOOST_REQUIRE_EQUAL(AWAITING_ARBS, get_casefile(0)["case_status"].as<uint8_t>());
+
+	BOOST_REQUIRE_EXCEPTION(
+		assigncase(0, respondant),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("no available arbitrators for this case")
+	);
+
+	// anyone can retry once an arbitrator is available, the case opens with a short panel
+	newarbstatus(AVAILABLE, test_voters[0]);
+	setlangcodes(test_voters[0], lang_codes);
+	assigncase(0, respondant);
+	produce_blocks();
+
+	auto cf = get_casefile(0);
+	BOOST_REQUIRE_EQUAL(CASE_INVESTIGATION, cf["case_status"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(1, cf["arbitrators"].as<vector<name>>().size());
+
+	// the short panel is topped up later
+	newarbstatus(AVAILABLE, test_voters[1]);
+	setlangcodes(test_voters[1], lang_codes);
+	assigncase(0, claimant);
+	produce_blocks();
+
+	auto panel = get_casefile(0)["arbitrators"].as<vector<name>>();
+	BOOST_REQUIRE_EQUAL(2, panel.size());
+	BOOST_REQUIRE_EQUAL(test_voters[0], panel[0]);
+	BOOST_REQUIRE_EQUAL(test_voters[1], panel[1]);
+	BOOST_REQUIRE_EQUAL(1, get_arbitrator(test_voters[1])["open_cases"].as<uint32_t>());
+
+	BOOST_REQUIRE_EXCEPTION(
+		assigncase(0, respondant),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("case panel is already full")
+	);
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( assign_scan_limit, eosio_arb_tester ) try {
+	const symbol vote_sym = symbol(4, "VOTE");
+	const symbol tlos_sym = symbol(4, "TLOS");
+	const uint32_t term_length = 86400 * 10;
+
+	// the first 50 arbitrators in bylangs order are elected first, so their terms end first
+	vector<name> arbs(test_voters.begin(), test_voters.begin() + 52);
+	std::sort(arbs.begin(), arbs.end(), [](const name& a, const name& b) { return a.value < b.value; });
+	vector<name> voters(test_voters.begin() + 60, test_voters.begin() + 70);
+
+	setconfig(100, 300, 300, term_length, { int64_t(1), int64_t(2), int64_t(3), int64_t(4) });
+	produce_blocks();
+
+	bool first_election = true;
+	auto run_election = [&](vector<name>::iterator first, vector<name>::iterator last) {
+		init_election();
+		produce_blocks();
+		auto cbid = get_config()["current_ballot_id"].as_uint64();
+
+		vector<uint16_t> directions;
+		for (auto itr = first; itr != last; itr++) {
+			regarb(*itr, claim_link1);
+			candaddlead(*itr, claim_link1);
+			directions.emplace_back(uint16_t(directions.size()));
+			produce_blocks();
+		}
+
+		produce_block(fc::seconds(300));
+		produce_blocks();
+
+		for (const auto& voter : voters) {
+			if (first_election) {
+				regvoter(voter, vote_sym);
+				mirrorcast(voter, tlos_sym);
+			}
+			castvotes(voter, cbid, directions);
+			produce_blocks();
+		}
+		first_election = false;
+
+		produce_block(fc::seconds(300));
+		produce_blocks();
+
+		do {
+			endelection(*first);
+			produce_blocks();
+		} while (get_config()["election_phase"].as<uint8_t>() != PHASE_IDLE);
+	};
+
+	run_election(arbs.begin(), arbs.begin() + 50);
+	produce_block(fc::seconds(3600));
+	produce_blocks();
+	run_election(arbs.begin() + 50, arbs.end());
+
+	for (const auto& arb : arbs) {
+		newarbstatus(AVAILABLE, arb);
+		setlangcodes(arb, {1});
+		produce_blocks();
+	}
+
+	// the first 50 terms run out, their rows stay AVAILABLE until a new election marks them
+	auto first_expiration = get_arbitrator(arbs[0])["term_expiration"].as<uint32_t>();
+	produce_block(fc::seconds(first_expiration - control->head_block_time().sec_since_epoch() + 1));
+	produce_blocks();
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+	setpanelsize(1);
+
+	// 50 expired rows use up the scan before the two seated arbitrators are reached
+	fileready(claimant, {claim_link1}, {1}, respondant);
+	produce_blocks();
+	BOOST_REQUIRE_EQUAL(AWAITING_ARBS, get_casefile(0)["case_status"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(0, get_casefile(0)["arbitrators"].as<vector<name>>().size());
+
+	// with one expired row out of the way the 50th row scanned is a seated arbitrator
+	dismissarb(arbs[0], false);
+	fileready(claimant, {claim_link2}, {1}, respondant);
+	produce_blocks();
+
+	auto panel = get_casefile(1)["arbitrators"].as<vector<name>>();
+	BOOST_REQUIRE_EQUAL(1, panel.size());
+	BOOST_REQUIRE_EQUAL(arbs[50], panel[0]);
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( case_events, eosio_arb_tester ) try {
+	elect_arbitrators(2, 10);
+	for (uint8_t i = 0; i < 2; i++) {
+		newarbstatus(AVAILABLE, test_voters[i]);
+		setlangcodes(test_voters[i], lang_codes);
+	}
+	produce_blocks();
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+
+	auto events = get_events(filecase(claimant, claim_link1, lang_codes, respondant));
+	BOOST_REQUIRE_EQUAL(1, events.size());
+	REQUIRE_MATCHING_OBJECT(events[0], mvo()
+		("version", 1)
+		("event_type", CASE_FILED)
+		("case_id", 0)
+		("case_status", CASE_SETUP)
+		("actor", claimant)
+		("ref_id", 0)
+	);
+
+	events = get_events(addclaim(0, claim_link2, claimant));
+	BOOST_REQUIRE_EQUAL(1, events.size());
+	BOOST_REQUIRE_EQUAL(CLAIM_ADDED, events[0]["event_type"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(1, events[0]["ref_id"].as<uint64_t>());
+
+	setpanelsize(2);
+	events = get_events(readycase(0, claimant));
+	BOOST_REQUIRE_EQUAL(3, events.size());
+	BOOST_REQUIRE_EQUAL(CASE_READIED, events[0]["event_type"].as<uint8_t>());
+	for (uint8_t i = 1; i < 3; i++) {
+		BOOST_REQUIRE_EQUAL(ARB_ASSIGNED, events[i]["event_type"].as<uint8_t>());
+		BOOST_REQUIRE_EQUAL(CASE_INVESTIGATION, events[i]["case_status"].as<uint8_t>());
+	}
+	produce_blocks();
+
+	auto panel = get_casefile(0)["arbitrators"].as<vector<name>>();
+	events = get_events(acceptclaim(0, panel[0], claim_link1, ruling_links[0], A_TORT));
+	BOOST_REQUIRE_EQUAL(1, events.size());
+	BOOST_REQUIRE_EQUAL(CLAIM_ACCEPTED, events[0]["event_type"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(panel[0], events[0]["actor"].as<name>());
+
+	events = get_events(advancecase(0, panel[0]));
+	BOOST_REQUIRE_EQUAL(CASE_APPROVED, events[0]["event_type"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(CASE_INVESTIGATION, events[0]["case_status"].as<uint8_t>());
+
+	events = get_events(advancecase(0, panel[1]));
+	BOOST_REQUIRE_EQUAL(CASE_ADVANCED, events[0]["event_type"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(HEARING, events[0]["case_status"].as<uint8_t>());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( case_deadlines, eosio_arb_tester ) try {
+	auto one_day = 86400;
+
+	BOOST_REQUIRE_EXCEPTION(
+		setdeadlines(vector<uint32_t>(RESOLVED + 1, one_day)),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("deadlines can only be set for states before RESOLVED")
+	);
+
+	// CASE_SETUP: 1 day, AWAITING_ARBS: 2 days
+	setdeadlines({uint32_t(one_day), uint32_t(one_day * 2)});
+	produce_blocks();
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+
+	filecase(claimant, claim_link1, lang_codes, respondant);
+	filecase(claimant, claim_link2, lang_codes, respondant);
+	readycase(1, claimant);
+	produce_blocks();
+
+	auto cf = get_casefile(0);
+	BOOST_REQUIRE_EQUAL(cf["filed_time"].as<uint32_t>() + one_day, cf["deadline"].as<uint32_t>());
+	cf = get_casefile(1);
+	BOOST_REQUIRE_EQUAL(cf["last_edit"].as<uint32_t>() + one_day * 2, cf["deadline"].as<uint32_t>());
+
+	BOOST_REQUIRE_EXCEPTION(
+		sweepcases(10, bad_actor),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("no overdue cases to sweep")
+	);
+
+	// stale setups are shredded along with their unread claims
+	produce_block(fc::seconds(one_day + 1));
+	produce_blocks();
+	auto events = get_events(sweepcases(10, bad_actor));
+	BOOST_REQUIRE_EQUAL(1, events.size());
+	BOOST_REQUIRE_EQUAL(CASE_SHREDDED, events[0]["event_type"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(0, events[0]["case_id"].as<uint64_t>());
+	produce_blocks();
+
+	BOOST_REQUIRE_EQUAL(true, get_casefile(0).is_null());
+	BOOST_REQUIRE_EQUAL(true, get_unread_claim(0, claim_link1).is_null());
+	BOOST_REQUIRE_EQUAL(AWAITING_ARBS, get_casefile(1)["case_status"].as<uint8_t>());
+
+	// other overdue cases are flagged once and keep their status
+	produce_block(fc::seconds(one_day));
+	produce_blocks();
+	events = get_events(sweepcases(10, bad_actor));
+	BOOST_REQUIRE_EQUAL(1, events.size());
+	BOOST_REQUIRE_EQUAL(CASE_OVERDUE, events[0]["event_type"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(1, events[0]["case_id"].as<uint64_t>());
+	produce_blocks();
+
+	cf = get_casefile(1);
+	BOOST_REQUIRE_EQUAL(AWAITING_ARBS, cf["case_status"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(0, cf["deadline"].as<uint32_t>());
+
+	BOOST_REQUIRE_EXCEPTION(
+		sweepcases(10, bad_actor),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("no overdue cases to sweep")
+	);
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( arb_stats, eosio_arb_tester ) try {
+	elect_arbitrators(2, 10);
+	newarbstatus(AVAILABLE, test_voters[0]);
+	setlangcodes(test_voters[0], lang_codes);
+	setpanelsize(1);
+	produce_blocks();
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+
+	filecase(claimant, claim_link1, lang_codes, respondant);
+	filecase(claimant, claim_link2, lang_codes, respondant);
+	produce_blocks();
+
+	auto stats = get_stats();
+	BOOST_REQUIRE_EQUAL(2, stats["cases_by_status"].as<vector<uint64_t>>()[CASE_SETUP]);
+
+	shredcase(1, claimant);
+	readycase(0, claimant);
+	produce_blocks();
+
+	stats = get_stats();
+	auto cases_by_status = stats["cases_by_status"].as<vector<uint64_t>>();
+	BOOST_REQUIRE_EQUAL(0, cases_by_status[CASE_SETUP]);
+	BOOST_REQUIRE_EQUAL(0, cases_by_status[AWAITING_ARBS]);
+	BOOST_REQUIRE_EQUAL(1, cases_by_status[CASE_INVESTIGATION]);
+	BOOST_REQUIRE_EQUAL(asset::from_string("0.0001 TLOS"), stats["fees_collected"].as<asset>());
+
+	acceptclaim(0, test_voters[0], claim_link1, ruling_links[0], A_TORT);
+	produce_block(fc::seconds(100));
+	dismisscase(0, test_voters[0], ruling_links[1]);
+	produce_blocks();
+
+	stats = get_stats();
+	cases_by_status = stats["cases_by_status"].as<vector<uint64_t>>();
+	auto cf = get_casefile(0);
+	BOOST_REQUIRE_EQUAL(0, cases_by_status[CASE_INVESTIGATION]);
+	BOOST_REQUIRE_EQUAL(1, cases_by_status[DISMISSED]);
+	BOOST_REQUIRE_EQUAL(1, stats["decisions_by_class"].as<vector<uint64_t>>()[A_TORT]);
+	BOOST_REQUIRE_EQUAL(1, stats["closed_cases"].as<uint64_t>());
+	BOOST_REQUIRE_EQUAL(cf["last_edit"].as<uint32_t>() - cf["filed_time"].as<uint32_t>(),
+		stats["total_resolution_time"].as<uint64_t>());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( batch_claims, eosio_arb_tester ) try {
+	elect_arbitrators(2, 10);
+	newarbstatus(AVAILABLE, test_voters[0]);
+	setlangcodes(test_voters[0], lang_codes);
+	setpanelsize(1);
+	produce_blocks();
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+
+	filecase(claimant, claim_link1, lang_codes, respondant);
+	produce_blocks();
+
+	BOOST_REQUIRE_EXCEPTION(
+		addclaims(0, {claim_links[0], claim_links[0]}, claimant),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("ipfs hash exists in another claim")
+	);
+
+	addclaims(0, claim_links, claimant);
+	readycase(0, claimant);
+	produce_blocks();
+
+	auto unread = get_unread_claims(0);
+	BOOST_REQUIRE_EQUAL(5, unread.size());
+	BOOST_REQUIRE_EQUAL(4, unread[4]["claim_id"].as<uint64_t>());
+
+	// a failed ruling in the batch reverts the whole batch
+	BOOST_REQUIRE_EXCEPTION(
+		acceptclaims(0, test_voters[0], {
+			mvo()("claim_hash", claim_links[0])("decision_link", ruling_links[0])("decision_class", A_TORT),
+			mvo()("claim_hash", claim_link2)("decision_link", ruling_links[1])("decision_class", A_TORT)
+		}),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("Claim Hash not found in casefile")
+	);
+
+	auto events = get_events(acceptclaims(0, test_voters[0], {
+		mvo()("claim_hash", claim_links[0])("decision_link", ruling_links[0])("decision_class", A_TORT),
+		mvo()("claim_hash", claim_links[1])("decision_link", ruling_links[1])("decision_class", MISC)
+	}));
+	BOOST_REQUIRE_EQUAL(2, events.size());
+
+	dismissclaims(0, test_voters[0], {claim_links[2], claim_links[3]}, "not valid");
+	produce_blocks();
+
+	auto cf = get_casefile(0);
+	auto accepted = cf["accepted_claims"].as<vector<uint64_t>>();
+	BOOST_REQUIRE_EQUAL(2, accepted.size());
+	BOOST_REQUIRE_EQUAL(MISC, get_claim(accepted[1])["decision_class"].as<uint8_t>());
+
+	unread = get_unread_claims(0);
+	BOOST_REQUIRE_EQUAL(1, unread.size());
+	BOOST_REQUIRE_EQUAL(to_cid(claim_link1), unread[0]["claim_summary"].as_string());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( file_ready_case, eosio_arb_tester ) try {
+	elect_arbitrators(2, 10);
+	newarbstatus(AVAILABLE, test_voters[0]);
+	setlangcodes(test_voters[0], lang_codes);
+	setpanelsize(1);
+	produce_blocks();
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+
+	BOOST_REQUIRE_EXCEPTION(
+		fileready(claimant, {claim_link1, claim_link1}, lang_codes, respondant),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("ipfs hash exists in another claim")
+	);
+
+	fileready(claimant, {claim_link1, claim_link2}, lang_codes, respondant);
+	produce_blocks();
+
+	auto cf = get_casefile(0);
+	BOOST_REQUIRE_EQUAL(CASE_INVESTIGATION, cf["case_status"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(2, get_unread_claims(0).size());
+
+	BOOST_REQUIRE_EXCEPTION(
+		transfer(claimant.value, N(eosio.arb), asset::from_string("1.0000 TLOS"), "filecase|respondant|0,1,2"),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("filecase memo must be filecase|<respondant>|<lang codes>|<claim links>")
+	);
+
+	string memo = "filecase||0,1,2|" + claim_links[0] + "," + claim_links[1] + "," + claim_links[2];
+	BOOST_REQUIRE_EXCEPTION(
+		transfer(claimant.value, N(eosio.arb), asset::from_string("1.5000 TLOS"), memo),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("transfer must cover the filing fee and claim deposit")
+	);
+
+	// the transfer covers the filing fee and a 0.5000 TLOS deposit per claim, so the case is
+	// filed and readied in the same transfer
+	transfer(claimant.value, N(eosio.arb), asset::from_string("1.5001 TLOS"), memo);
+	produce_blocks();
+
+	cf = get_casefile(1);
+	BOOST_REQUIRE_EQUAL(claimant, cf["claimant"].as<name>());
+	BOOST_REQUIRE_EQUAL(name(0), cf["respondant"].as<name>());
+	BOOST_REQUIRE_EQUAL(CASE_INVESTIGATION, cf["case_status"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(3, get_unread_claims(1).size());
+	// only the two filing fees count as fees, the claim deposit is kept out of the stats
+	BOOST_REQUIRE_EQUAL(asset::from_string("0.0002 TLOS"), get_stats()["fees_collected"].as<asset>());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( claim_index, eosio_arb_tester ) try {
+	elect_arbitrators(2, 10);
+	newarbstatus(AVAILABLE, test_voters[0]);
+	setlangcodes(test_voters[0], lang_codes);
+	setpanelsize(1);
+	produce_blocks();
+
+	transfer(N(eosio), claimant.value, asset::from_string("1000.0000 TLOS"), "");
+	transfer(claimant.value, N(eosio.arb), asset::from_string("200.0000 TLOS"), "");
+
+	// the same document may back claims in different cases
+	fileready(claimant, {claim_link1, claim_links[0], claim_links[1]}, lang_codes, respondant);
+	filecase(claimant, claim_link1, lang_codes, respondant);
+	produce_blocks();
+
+	auto refs = get_claim_refs(claim_link1);
+	BOOST_REQUIRE_EQUAL(2, refs.size());
+	BOOST_REQUIRE_EQUAL(0, refs[0]["case_id"].as<uint64_t>());
+	BOOST_REQUIRE_EQUAL(1, refs[1]["case_id"].as<uint64_t>());
+	BOOST_REQUIRE_EQUAL(false, refs[1]["accepted"].as<bool>());
+
+	BOOST_REQUIRE_EXCEPTION(
+		addclaim(1, claim_link1, claimant),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("ipfs hash exists in another claim")
+	);
+
+	addclaim(1, claim_link2, claimant);
+	removeclaim(1, claim_link2, claimant);
+	produce_blocks();
+	BOOST_REQUIRE_EQUAL(0, get_claim_refs(claim_link2).size());
+
+	acceptclaim(0, test_voters[0], claim_links[0], ruling_links[0], A_TORT);
+	dismissclaim(0, test_voters[0], claim_links[1], "not valid");
+	produce_blocks();
+
+	refs = get_claim_refs(claim_links[0]);
+	BOOST_REQUIRE_EQUAL(1, refs.size());
+	BOOST_REQUIRE_EQUAL(true, refs[0]["accepted"].as<bool>());
+	BOOST_REQUIRE_EQUAL(get_casefile(0)["accepted_claims"].as<vector<uint64_t>>()[0], refs[0]["claim_id"].as<uint64_t>());
+	BOOST_REQUIRE_EQUAL(0, get_claim_refs(claim_links[1]).size());
+
+	respond(0, claim_link1, respondant, response_link1);
+	produce_blocks();
+	BOOST_REQUIRE_EQUAL(to_cid(response_link1), get_unread_claim(0, claim_link1)["response_link"].as_string());
+
+	shredcase(1, claimant);
+	produce_blocks();
+
+	refs = get_claim_refs(claim_link1);
+	BOOST_REQUIRE_EQUAL(1, refs.size());
+	BOOST_REQUIRE_EQUAL(0, refs[0]["case_id"].as<uint64_t>());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( ballot_header, eosio_arb_tester ) try {
+	setconfig(20, 300, 300, 86400 * 10, { int64_t(1), int64_t(2), int64_t(3), int64_t(4) });
+	init_election();
+	produce_blocks();
+
+	auto cbid = get_config()["current_ballot_id"].as_uint64();
+	auto board = get_leaderboard(get_ballot(cbid)["reference_id"].as_uint64());
+	auto header = get_ballot_header(cbid);
+
+	BOOST_REQUIRE_EQUAL(2, header["table_id"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(board["board_id"].as_uint64(), header["reference_id"].as_uint64());
+	BOOST_REQUIRE_EQUAL(board["begin_time"].as<uint32_t>(), header["begin_time"].as<uint32_t>());
+	BOOST_REQUIRE_EQUAL(board["end_time"].as<uint32_t>(), header["end_time"].as<uint32_t>());
+	BOOST_REQUIRE_EQUAL(board["available_seats"].as<uint8_t>(), header["available_seats"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(0, header["candidate_count"].as<uint16_t>());
+
+	voter_map(0, 2, [&](auto& account) {
+		regarb(account, claim_link1);
+		candaddlead(account, claim_link1);
+		produce_blocks();
+	});
+	BOOST_REQUIRE_EQUAL(2, get_ballot_header(cbid)["candidate_count"].as<uint16_t>());
+
+	candrmvlead(test_voters[1]);
+	produce_blocks();
+	BOOST_REQUIRE_EQUAL(1, get_ballot_header(cbid)["candidate_count"].as<uint16_t>());
+
+	produce_block(fc::seconds(600));
+	produce_blocks();
+
+	endelection(test_voters[0]);
+	produce_blocks();
+
+	BOOST_REQUIRE_EQUAL(CLOSED, get_ballot_header(cbid)["status"].as<uint8_t>());
+	BOOST_REQUIRE_EQUAL(CLOSED, get_leaderboard(board["board_id"].as_uint64())["status"].as<uint8_t>());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE( multi_direction_vote, eosio_arb_tester ) try {
+	const symbol vote_sym = symbol(4, "VOTE");
+	const symbol tlos_sym = symbol(4, "TLOS");
+
+	setconfig(20, 300, 300, 86400 * 10, { int64_t(1), int64_t(2), int64_t(3), int64_t(4) });
+	init_election();
+	produce_blocks();
+
+	auto cbid = get_config()["current_ballot_id"].as_uint64();
+	auto bid = get_ballot(cbid)["reference_id"].as_uint64();
+
+	voter_map(0, 3, [&](auto& account) {
+		regarb(account, claim_link1);
+		candaddlead(account, claim_link1);
+		produce_blocks();
+	});
+
+	produce_block(fc::seconds(300));
+	produce_blocks();
+
+	voter_map(3, 5, [&](auto& account) {
+		regvoter(account, vote_sym);
+		mirrorcast(account, tlos_sym);
+		produce_blocks();
+	});
+
+	BOOST_REQUIRE_EXCEPTION(
+		castvotes(test_voters[3], cbid, {0, 2, 0}),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("directions cannot contain duplicates")
+	);
+
+	BOOST_REQUIRE_EXCEPTION(
+		castvotes(test_voters[3], cbid, {0, 3}),
+		eosio_assert_message_exception,
+		eosio_assert_message_is("direction must map to an existing candidate in the leaderboard struct")
+	);
+
+	castvotes(test_voters[3], cbid, {0, 2});
+	castvote(test_voters[4], cbid, 2);
+	produce_blocks();
+	castvotes(test_voters[4], cbid, {0, 1});
+	produce_blocks();
+
+	auto receipt = get_vote_receipt(test_voters[3], cbid);
+	BOOST_REQUIRE_EQUAL(2, receipt["directions"].as<vector<uint16_t>>().size());
+	BOOST_REQUIRE_EQUAL(3, get_vote_receipt(test_voters[4], cbid)["directions"].as<vector<uint16_t>>().size());
 
-	BOOST_REQUIRE_EQUAL(0, open_ids.size());
+	auto weight = receipt["weight"].as<asset>().get_amount();
+	BOOST_REQUIRE_EQUAL(weight * 2, get_tally(bid, 0)["votes"].as<int64_t>());
+	BOOST_REQUIRE_EQUAL(weight, get_tally(bid, 1)["votes"].as<int64_t>());
+	BOOST_REQUIRE_EQUAL(weight * 2, get_tally(bid, 2)["votes"].as<int64_t>());
+	BOOST_REQUIRE_EQUAL(2, get_ballot_header(cbid)["unique_voters"].as<uint32_t>());
 } FC_LOG_AND_RETHROW()
 
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -216,6 +216,16 @@ class eosio_trail_tester : public tester
 		return data.empty() ? fc::variant() : abi_ser.binary_to_variant("ballot", data, abi_serializer_max_time);
 	}
 
+	fc::variant get_tally(uint64_t board_id, uint16_t direction) {
+		vector<char> data = get_row_by_account(N(eosio.trail), board_id, N(tallies), direction);
+		return data.empty() ? fc::variant() : abi_ser.binary_to_variant("tally", data, abi_serializer_max_time);
+	}
+
+	fc::variant get_ballot_header(uint64_t ballot_id) {
+		vector<char> data = get_row_by_account(N(eosio.trail), N(eosio.trail), N(ballotheader), ballot_id);
+		return data.empty() ? fc::variant() : abi_ser.binary_to_variant("ballot_header", data, abi_serializer_max_time);
+	}
+
 	fc::variant get_proposal(uint64_t proposal_id) {
 		vector<char> data = get_row_by_account(N(eosio.trail), N(eosio.trail), N(proposals), proposal_id);
 		return data.empty() ? fc::variant() : abi_ser.binary_to_variant("proposal", data, abi_serializer_max_time);
@@ -292,6 +302,20 @@ class eosio_trail_tester : public tester
 		return push_transaction( trx );
 	}
 
+	transaction_trace_ptr castvotes(account_name voter, uint32_t ballot_id, vector<uint16_t> directions) {
+		signed_transaction trx;
+		trx.actions.emplace_back( get_action(N(eosio.trail), N(castvotes), vector<permission_level>{{voter, config::active_name}},
+			mvo()
+			("voter", voter)
+			("ballot_id", ballot_id)
+			("directions", directions)
+			)
+		);
+		set_transaction_headers(trx);
+		trx.sign(get_private_key(voter, "active"), control->get_chain_id());
+		return push_transaction( trx );
+	}
+
 	transaction_trace_ptr deloldvotes(account_name voter, uint16_t num_to_delete) {
 		signed_transaction trx;
 		trx.actions.emplace_back( get_action(N(eosio.trail), N(deloldvotes), vector<permission_level>{{voter, config::active_name}},